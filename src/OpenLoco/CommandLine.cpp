@@ -1,8 +1,12 @@
 #include "CommandLine.h"
 #include "GameState.h"
+#include "Map/TileManager.h"
 #include "OpenLoco.h"
+#include "Profiler.h"
 #include "S5/S5.h"
 #include "S5/SawyerStream.h"
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <optional>
 #include <string_view>
@@ -14,6 +18,7 @@ namespace OpenLoco
 
     static int uncompressFile(const CommandLineOptions& options);
     static int simulate(const CommandLineOptions& options);
+    static int benchmark(const CommandLineOptions& options);
 
     const CommandLineOptions& getCommandLineOptions()
     {
@@ -326,7 +331,8 @@ namespace OpenLoco
                           .registerOption("-o", 1)
                           .registerOption("--help", "-h")
                           .registerOption("--version")
-                          .registerOption("--intro");
+                          .registerOption("--intro")
+                          .registerOption("--trace", 1);
 
         if (!parser.parse())
         {
@@ -371,6 +377,15 @@ namespace OpenLoco
                 options.path = parser.getArg(1);
                 options.ticks = parser.getArg<int32_t>(2);
             }
+            else if (firstArg == "benchmark")
+            {
+                options.action = CommandLineAction::benchmark;
+                options.ticks = parser.getArg<int32_t>(1);
+                for (size_t i = 2; !parser.getArg(i).empty(); i++)
+                {
+                    options.paths.emplace_back(parser.getArg(i));
+                }
+            }
             else
             {
                 options.path = parser.getArg(0);
@@ -382,6 +397,7 @@ namespace OpenLoco
         if (!options.port)
             options.port = parser.getArg<int32_t>("-p");
         options.outputPath = parser.getArg("-o");
+        options.tracePath = parser.getArg("--trace");
 
         return options;
     }
@@ -410,6 +426,7 @@ namespace OpenLoco
         std::cout << "                join [options] <address>" << std::endl;
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks>" << std::endl;
+        std::cout << "                benchmark [options] <ticks> <path>..." << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind            Address to bind to when hosting a server" << std::endl;
@@ -418,6 +435,7 @@ namespace OpenLoco
         std::cout << "--help     -h     Print help" << std::endl;
         std::cout << "--version         Print version" << std::endl;
         std::cout << "--intro           Run the game intro" << std::endl;
+        std::cout << "--trace           Write a Chrome trace of the profiled ticks and frames on exit" << std::endl;
     }
 
     std::optional<int> runCommandLineOnlyCommand(const CommandLineOptions& options)
@@ -434,6 +452,8 @@ namespace OpenLoco
                 return uncompressFile(options);
             case CommandLineAction::simulate:
                 return simulate(options);
+            case CommandLineAction::benchmark:
+                return benchmark(options);
             default:
                 return {};
         }
@@ -568,4 +588,182 @@ namespace OpenLoco
 
         return 0;
     }
+
+    struct BenchmarkResult
+    {
+        std::string path;
+        std::vector<Profiler::TickTimings> timings;
+        uint64_t stateHash;
+        uint64_t tileElementEncodeNs;
+    };
+
+    // Times the Sawyer encoding of the current tile elements, which dominates the time taken to save large maps
+    static uint64_t benchmarkTileElementEncode()
+    {
+        const auto elements = Map::TileManager::getElements();
+        MemoryStream ms;
+        SawyerStreamWriter writer(ms);
+
+        const auto start = Profiler::Clock::now();
+        writer.writeChunk(SawyerEncoding::runLengthMulti, elements.data(), elements.size() * sizeof(Map::TileElement));
+        const auto duration = Profiler::Clock::now() - start;
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    // FNV-1a over the whole game state and all tile elements
+    static uint64_t hashGameState()
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        auto hashBytes = [&hash](const void* data, size_t size) {
+            auto* bytes = reinterpret_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001B3ULL;
+            }
+        };
+
+        const auto& gameState = getGameState();
+        hashBytes(&gameState, sizeof(gameState));
+        const auto elements = Map::TileManager::getElements();
+        hashBytes(elements.data(), elements.size() * sizeof(Map::TileElement));
+        return hash;
+    }
+
+    static std::string escapeJson(std::string_view str)
+    {
+        std::string result;
+        for (auto ch : str)
+        {
+            if (ch == '"' || ch == '\\')
+            {
+                result.push_back('\\');
+            }
+            result.push_back(ch);
+        }
+        return result;
+    }
+
+    static double percentile(const std::vector<uint64_t>& sorted, double fraction)
+    {
+        if (sorted.empty())
+            return 0.0;
+
+        auto index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+        return static_cast<double>(sorted[std::min(index, sorted.size() - 1)]);
+    }
+
+    static void writeBenchmarkResult(FILE* output, const BenchmarkResult& result, bool last)
+    {
+        const auto numTicks = result.timings.size();
+        std::vector<uint64_t> tickTimes;
+        tickTimes.reserve(numTicks);
+        uint64_t totalNs = 0;
+        std::array<uint64_t, Profiler::kNumZones> zoneTotalNs{};
+        for (const auto& timing : result.timings)
+        {
+            tickTimes.push_back(timing.totalNs);
+            totalNs += timing.totalNs;
+            for (size_t i = 0; i < Profiler::kNumZones; i++)
+            {
+                zoneTotalNs[i] += timing.zoneNs[i];
+            }
+        }
+        std::sort(tickTimes.begin(), tickTimes.end());
+
+        const auto divisor = static_cast<double>(std::max<size_t>(numTicks, 1));
+        std::fprintf(output, "    {\n");
+        std::fprintf(output, "      \"path\": \"%s\",\n", escapeJson(result.path).c_str());
+        std::fprintf(output, "      \"ticks\": %zu,\n", numTicks);
+        std::fprintf(output, "      \"totalMs\": %.3f,\n", totalNs / 1e6);
+        std::fprintf(output, "      \"meanTickUs\": %.3f,\n", totalNs / divisor / 1e3);
+        std::fprintf(output, "      \"p50TickUs\": %.3f,\n", percentile(tickTimes, 0.50) / 1e3);
+        std::fprintf(output, "      \"p99TickUs\": %.3f,\n", percentile(tickTimes, 0.99) / 1e3);
+        std::fprintf(output, "      \"maxTickUs\": %.3f,\n", (tickTimes.empty() ? 0.0 : tickTimes.back()) / 1e3);
+        std::fprintf(output, "      \"subsystems\": {\n");
+        const char* separator = "";
+        for (size_t i = 0; i < Profiler::kNumZones; i++)
+        {
+            const auto zone = static_cast<Profiler::Zone>(i);
+            if (!Profiler::isTickZone(zone))
+                continue;
+
+            std::fprintf(
+                output,
+                "%s        \"%s\": { \"totalMs\": %.3f, \"meanTickUs\": %.3f }",
+                separator,
+                Profiler::getZoneName(zone),
+                zoneTotalNs[i] / 1e6,
+                zoneTotalNs[i] / divisor / 1e3);
+            separator = ",\n";
+        }
+        std::fprintf(output, "\n");
+        std::fprintf(output, "      },\n");
+        std::fprintf(output, "      \"tileElementEncodeMs\": %.3f,\n", result.tileElementEncodeNs / 1e6);
+        std::fprintf(output, "      \"stateHash\": \"%016llX\"\n", static_cast<unsigned long long>(result.stateHash));
+        std::fprintf(output, "    }%s\n", last ? "" : ",");
+    }
+
+    static int benchmark(const CommandLineOptions& options)
+    {
+        if (!options.ticks)
+        {
+            std::fprintf(stderr, "Number of ticks to simulate not specified\n");
+            return 2;
+        }
+        if (options.paths.empty())
+        {
+            std::fprintf(stderr, "No file specified.\n");
+            return 2;
+        }
+
+        std::vector<BenchmarkResult> results;
+        for (const auto& path : options.paths)
+        {
+            auto inPath = fs::u8path(path);
+            try
+            {
+                auto timings = OpenLoco::benchmarkGame(inPath, *options.ticks);
+                results.push_back({ path, std::move(timings), hashGameState(), benchmarkTileElementEncode() });
+            }
+            catch (const std::exception& e)
+            {
+                std::fprintf(stderr, "Unable to benchmark %s: %s\n", path.c_str(), e.what());
+                return 2;
+            }
+        }
+
+        FILE* output = stdout;
+        if (!options.outputPath.empty())
+        {
+            output = std::fopen(options.outputPath.c_str(), "w");
+            if (output == nullptr)
+            {
+                std::fprintf(stderr, "Unable to open %s for writing\n", options.outputPath.c_str());
+                return 2;
+            }
+        }
+
+        std::fprintf(output, "{\n");
+        std::fprintf(output, "  \"version\": \"%s\",\n", escapeJson(OpenLoco::getVersionInfo()).c_str());
+        std::fprintf(output, "  \"ticks\": %d,\n", *options.ticks);
+        std::fprintf(output, "  \"saves\": [\n");
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            writeBenchmarkResult(output, results[i], i + 1 == results.size());
+        }
+        std::fprintf(output, "  ]\n");
+        std::fprintf(output, "}\n");
+
+        if (output != stdout)
+        {
+            std::fclose(output);
+        }
+
+        if (!options.tracePath.empty() && !Profiler::exportChromeTrace(fs::u8path(options.tracePath)))
+        {
+            std::fprintf(stderr, "Unable to write trace to %s\n", options.tracePath.c_str());
+        }
+        return 0;
+    }
 }
@@ -2,6 +2,7 @@
 
 #include "Core/Optional.hpp"
 #include <string>
+#include <vector>
 
 namespace OpenLoco
 {
@@ -12,6 +13,7 @@ namespace OpenLoco
         join,
         uncompress,
         simulate,
+        benchmark,
         help,
         version,
         intro,
@@ -22,8 +24,10 @@ namespace OpenLoco
         CommandLineAction action = CommandLineAction::none;
         std::string address;
         std::string path;
+        std::vector<std::string> paths;
         std::optional<int32_t> ticks;
         std::string outputPath;
+        std::string tracePath;
         std::string bind;
         std::optional<uint16_t> port{};
     };
@@ -189,6 +189,8 @@ namespace OpenLoco::Config
             _newConfig.autosaveAmount = config["autosave_amount"].as<int32_t>();
         if (config["showFPS"])
             _newConfig.showFPS = config["showFPS"].as<bool>();
+        if (config["showProfiler"])
+            _newConfig.showProfiler = config["showProfiler"].as<bool>();
         if (config["uncapFPS"])
             _newConfig.uncapFPS = config["uncapFPS"].as<bool>();
         if (config["displayLockedVehicles"])
@@ -260,6 +262,7 @@ namespace OpenLoco::Config
         node["autosave_frequency"] = _newConfig.autosaveFrequency;
         node["autosave_amount"] = _newConfig.autosaveAmount;
         node["showFPS"] = _newConfig.showFPS;
+        node["showProfiler"] = _newConfig.showProfiler;
         node["uncapFPS"] = _newConfig.uncapFPS;
         node["displayLockedVehicles"] = _newConfig.displayLockedVehicles;
         node["buildLockedVehicles"] = _newConfig.buildLockedVehicles;
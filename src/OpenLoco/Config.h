@@ -177,6 +177,7 @@ namespace OpenLoco::Config
         int32_t autosaveFrequency = 1;
         int32_t autosaveAmount = 12;
         bool showFPS = false;
+        bool showProfiler = false;
         bool uncapFPS = false;
         KeyboardShortcut shortcuts[Input::ShortcutManager::kCount];
         bool displayLockedVehicles = false;
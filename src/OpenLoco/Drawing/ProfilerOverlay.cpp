@@ -0,0 +1,67 @@
+#include "ProfilerOverlay.h"
+#include "../Graphics/Colour.h"
+#include "../Graphics/Gfx.h"
+#include "../Localisation/StringManager.h"
+#include "../Paint/Paint.h"
+#include "../Profiler.h"
+#include "../Ui.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdio.h>
+
+namespace OpenLoco::Drawing
+{
+    // Roughly one second worth of ticks / frames
+    static constexpr size_t kNumAveragedEntries = 40;
+    static constexpr int16_t kLineHeight = 10;
+
+    static int16_t drawLine(Gfx::RenderTarget& rt, int16_t x, int16_t y, const char* name, uint64_t durationNs, bool indent)
+    {
+        char buffer[128];
+        buffer[0] = ControlCodes::Font::bold;
+        buffer[1] = ControlCodes::Font::outline;
+        buffer[2] = indent ? ControlCodes::Colour::white : ControlCodes::Colour::yellow;
+        snprintf(&buffer[3], std::size(buffer) - 3, "%s%s %.2f ms", indent ? "  " : "", name, durationNs / 1e6);
+
+        Gfx::drawString(rt, x, y, Colour::black, buffer);
+        return static_cast<int16_t>(Gfx::getStringWidth(buffer));
+    }
+
+    void drawProfiler()
+    {
+        const auto tick = Profiler::getAverageTick(kNumAveragedEntries);
+        const auto frame = Profiler::getAverageFrame(kNumAveragedEntries);
+
+        auto& rt = Gfx::getScreenRT();
+
+        // Draw next to the FPS counter
+        const auto x = Ui::width() / 2 + 32;
+        auto y = 2;
+        int16_t maxWidth = 0;
+
+        for (size_t i = 0; i < Profiler::kNumZones; i++)
+        {
+            const auto zone = static_cast<Profiler::Zone>(i);
+            const auto& timings = Profiler::isFrameZone(zone) || zone == Profiler::Zone::frame ? frame : tick;
+            const bool isSubZone = zone != Profiler::Zone::tick && zone != Profiler::Zone::frame;
+
+            const auto width = drawLine(rt, x, y, Profiler::getZoneName(zone), timings.zoneNs[i], isSubZone);
+            maxWidth = std::max(maxWidth, width);
+            y += kLineHeight;
+        }
+
+        const auto& arenaStats = Paint::getArenaStats();
+        char buffer[128];
+        buffer[0] = ControlCodes::Font::bold;
+        buffer[1] = ControlCodes::Font::outline;
+        buffer[2] = ControlCodes::Colour::yellow;
+        snprintf(&buffer[3], std::size(buffer) - 3, "Paint entries %u peak, %u total, %u chunks", arenaStats.peakEntries, arenaStats.totalEntries, arenaStats.numChunks);
+        Gfx::drawString(rt, x, y, Colour::black, buffer);
+        maxWidth = std::max(maxWidth, static_cast<int16_t>(Gfx::getStringWidth(buffer)));
+        y += kLineHeight;
+
+        // Make area dirty so the text doesn't get drawn over the last
+        Gfx::setDirtyBlocks(x, 0, x + maxWidth + 16, y + 4);
+    }
+}
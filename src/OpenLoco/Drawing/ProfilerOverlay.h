@@ -0,0 +1,6 @@
+#pragma once
+
+namespace OpenLoco::Drawing
+{
+    void drawProfiler();
+}
@@ -11,6 +11,7 @@
 #include "../SceneManager.h"
 #include "../Vehicles/Vehicle.h"
 #include "EntityTweener.h"
+#include <algorithm>
 
 using namespace OpenLoco::Interop;
 
@@ -25,6 +26,28 @@ namespace OpenLoco::EntityManager
     loco_global<EntityId[kSpatialEntityMapSize], 0x01025A8C> _entitySpatialIndex;
     loco_global<uint32_t, 0x01025A88> _entitySpatialCount;
 
+    // Compact copy of the spatial index chains (nextQuadrantId) and the entity base types. Walking the
+    // entities of a tile only touches these arrays rather than the 0x200 byte entity records.
+    static std::array<EntityId, Limits::kMaxEntities> _spatialNextIds;
+    static std::array<EntityBaseType, Limits::kMaxEntities> _spatialBaseTypes;
+
+    // Dense id arrays of the vehicleHead, vehicle and misc lists, see getDenseList. Ids are appended when an
+    // entity joins a list, so the array read backwards matches the linked list order as entities are always
+    // linked at the head. Removed entries are replaced by EntityId::null until the array is compacted, which
+    // only happens while updating entities, so an array can grow past kMaxEntities while the game is paused.
+    struct DenseList
+    {
+        std::vector<EntityId> ids;
+        size_t numRemoved = 0;
+    };
+    static std::array<DenseList, Limits::kNumEntityLists> _denseLists;
+    static std::array<uint32_t, Limits::kMaxEntities> _denseListIndices;
+
+    static bool hasDenseList(const EntityListType list)
+    {
+        return list == EntityListType::vehicleHead || list == EntityListType::vehicle || list == EntityListType::misc;
+    }
+
     static auto& rawEntities() { return getGameState().entities; }
     static auto entities() { return FixedVector(rawEntities()); }
     static auto& rawListHeads() { return getGameState().entityListHeads; }
@@ -87,6 +110,7 @@ namespace OpenLoco::EntityManager
         rawListCounts()[static_cast<uint8_t>(EntityListType::nullMoney)] = Limits::kMaxMoneyEntities;
 
         resetSpatialIndex();
+        rebuildDenseLists();
         EntityTweener::get().reset();
     }
 
@@ -137,10 +161,22 @@ namespace OpenLoco::EntityManager
         return _entitySpatialIndex[index];
     }
 
+    EntityId nextQuadrantId(EntityId id)
+    {
+        return _spatialNextIds[enumValue(id)];
+    }
+
+    EntityBaseType quadrantBaseType(EntityId id)
+    {
+        return _spatialBaseTypes[enumValue(id)];
+    }
+
     static void insertToSpatialIndex(EntityBase& entity, const size_t newIndex)
     {
         entity.nextQuadrantId = _entitySpatialIndex[newIndex];
         _entitySpatialIndex[newIndex] = entity.id;
+        _spatialNextIds[enumValue(entity.id)] = entity.nextQuadrantId;
+        _spatialBaseTypes[enumValue(entity.id)] = entity.baseType;
     }
 
     static void insertToSpatialIndex(EntityBase& entity)
@@ -175,14 +211,22 @@ namespace OpenLoco::EntityManager
 
     static bool removeFromSpatialIndex(EntityBase& entity, const size_t index)
     {
-        auto* quadId = &_entitySpatialIndex[index];
+        auto previousId = EntityId::null;
+        auto quadId = _entitySpatialIndex[index];
         _entitySpatialCount = 0;
-        while (enumValue(*quadId) < Limits::kMaxEntities)
+        while (enumValue(quadId) < Limits::kMaxEntities)
         {
-            auto* quadEnt = get<EntityBase>(*quadId);
-            if (quadEnt == &entity)
+            if (quadId == entity.id)
             {
-                *quadId = entity.nextQuadrantId;
+                if (previousId == EntityId::null)
+                {
+                    _entitySpatialIndex[index] = entity.nextQuadrantId;
+                }
+                else
+                {
+                    get<EntityBase>(previousId)->nextQuadrantId = entity.nextQuadrantId;
+                    _spatialNextIds[enumValue(previousId)] = entity.nextQuadrantId;
+                }
                 return true;
             }
             _entitySpatialCount++;
@@ -190,7 +234,8 @@ namespace OpenLoco::EntityManager
             {
                 break;
             }
-            quadId = &quadEnt->nextQuadrantId;
+            previousId = quadId;
+            quadId = _spatialNextIds[enumValue(quadId)];
         }
         return false;
     }
@@ -217,6 +262,9 @@ namespace OpenLoco::EntityManager
             insertToSpatialIndex(entity, newIndex);
         }
         entity.position = loc;
+
+        // The type is set by the caller after the entity is created
+        _spatialBaseTypes[enumValue(entity.id)] = entity.baseType;
     }
 
     static EntityBase* createEntity(EntityId id, EntityListType list)
@@ -304,6 +352,7 @@ namespace OpenLoco::EntityManager
     {
         if (Game::hasFlags(1u << 0) && !isEditorMode())
         {
+            compactDenseLists();
             for (auto v : VehicleList())
             {
                 v->updateVehicle();
@@ -316,7 +365,8 @@ namespace OpenLoco::EntityManager
     {
         if (getGameState().flags & (1u << 0))
         {
-            for (auto* misc : EntityList<EntityListIterator<MiscBase>, EntityListType::misc>())
+            compactDenseLists();
+            for (auto* misc : DenseEntityList<MiscBase, EntityListType::misc>())
             {
                 misc->update();
             }
@@ -402,6 +452,71 @@ namespace OpenLoco::EntityManager
 
         rawListCounts()[curList]--;
         rawListCounts()[static_cast<uint8_t>(list)]++;
+
+        const auto id = enumValue(entity->id);
+        if (hasDenseList(static_cast<EntityListType>(curList)))
+        {
+            auto& denseList = _denseLists[curList];
+            denseList.ids[_denseListIndices[id]] = EntityId::null;
+            denseList.numRemoved++;
+        }
+        if (hasDenseList(list))
+        {
+            auto& denseList = _denseLists[static_cast<uint8_t>(list)];
+            _denseListIndices[id] = static_cast<uint32_t>(denseList.ids.size());
+            denseList.ids.push_back(entity->id);
+        }
+    }
+
+    // Ids of the entities in the vehicleHead, vehicle or misc list in reverse linked list order. Entries of
+    // removed entities are EntityId::null.
+    const std::vector<EntityId>& getDenseList(const EntityListType list)
+    {
+        return _denseLists[static_cast<uint8_t>(list)].ids;
+    }
+
+    // Rebuilds the dense arrays from the linked lists, needed whenever the lists are replaced wholesale.
+    void rebuildDenseLists()
+    {
+        for (uint8_t i = 0; i < Limits::kNumEntityLists; i++)
+        {
+            auto& denseList = _denseLists[i];
+            denseList.ids.clear();
+            denseList.numRemoved = 0;
+            if (!hasDenseList(static_cast<EntityListType>(i)))
+                continue;
+
+            // Walk the linked list from its head, then reverse so the head ends up last
+            auto id = rawListHeads()[i];
+            while (enumValue(id) < Limits::kMaxEntities && denseList.ids.size() < Limits::kMaxEntities)
+            {
+                denseList.ids.push_back(id);
+                id = get<EntityBase>(id)->nextThingId;
+            }
+            std::reverse(denseList.ids.begin(), denseList.ids.end());
+            for (size_t index = 0; index < denseList.ids.size(); index++)
+            {
+                _denseListIndices[enumValue(denseList.ids[index])] = static_cast<uint32_t>(index);
+            }
+        }
+    }
+
+    // Drops the entries of removed entities, must not be called while iterating a DenseEntityList.
+    void compactDenseLists()
+    {
+        for (auto& denseList : _denseLists)
+        {
+            if (denseList.numRemoved == 0)
+                continue;
+
+            auto& ids = denseList.ids;
+            ids.erase(std::remove(ids.begin(), ids.end(), EntityId::null), ids.end());
+            for (size_t index = 0; index < ids.size(); index++)
+            {
+                _denseListIndices[enumValue(ids[index])] = static_cast<uint32_t>(index);
+            }
+            denseList.numRemoved = 0;
+        }
     }
 
     // 0x00470188
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "../Map/Map.hpp"
+#include "../Limits.h"
 #include "Entity.h"
 #include <cstdio>
 #include <iterator>
+#include <optional>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -42,6 +45,8 @@ namespace OpenLoco::EntityManager
     T* first();
 
     EntityId firstQuadrantId(const Map::Pos2& loc);
+    EntityId nextQuadrantId(EntityId id);
+    EntityBaseType quadrantBaseType(EntityId id);
     void resetSpatialIndex();
     void updateSpatialIndex();
     void moveSpatialEntry(EntityBase& entity, const Map::Pos3& loc);
@@ -58,6 +63,9 @@ namespace OpenLoco::EntityManager
 
     uint16_t getListCount(const EntityListType list);
     void moveEntityToList(EntityBase* const entity, const EntityListType list);
+    const std::vector<EntityId>& getDenseList(const EntityListType list);
+    void rebuildDenseLists();
+    void compactDenseLists();
     bool checkNumFreeEntities(const size_t numNewEntities);
     void zeroUnused();
 
@@ -141,13 +149,167 @@ namespace OpenLoco::EntityManager
         }
     };
 
-    using VehicleList = EntityList<EntityListIterator<Vehicles::VehicleHead>, EntityListType::vehicleHead>;
+    // Iterates one of the vehicleHead, vehicle or misc lists through its dense id array, see getDenseList.
+    // The order matches walking the linked list from its head. Entities added while iterating are not
+    // visited and entities removed while iterating are skipped.
+    template<typename T, EntityListType list>
+    class DenseEntityList
+    {
+    private:
+        class Iterator
+        {
+        private:
+            const std::vector<EntityId>* ids = nullptr;
+            size_t position = 0; // One past the current index, 0 is the end
+
+            void skipRemoved()
+            {
+                while (position > 0 && (*ids)[position - 1] == EntityId::null)
+                {
+                    position--;
+                }
+            }
+
+        public:
+            Iterator(const std::vector<EntityId>& _ids, size_t _position)
+                : ids(&_ids)
+                , position(_position)
+            {
+                skipRemoved();
+            }
+
+            Iterator& operator++()
+            {
+                position--;
+                skipRemoved();
+                return *this;
+            }
 
+            Iterator operator++(int)
+            {
+                Iterator retval = *this;
+                ++(*this);
+                return retval;
+            }
+            bool operator==(const Iterator& other) const
+            {
+                return position == other.position;
+            }
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+            T* operator*()
+            {
+                auto* entity = get<T>((*ids)[position - 1]);
+                if (entity == nullptr)
+                {
+                    throw "Bad Entity List!";
+                }
+                return entity;
+            }
+            // iterator traits
+            using difference_type = std::ptrdiff_t;
+            using value_type = T;
+            using pointer = T*;
+            using reference = T&;
+            using iterator_category = std::forward_iterator_tag;
+        };
+
+        const std::vector<EntityId>& ids;
+
+    public:
+        DenseEntityList()
+            : ids(getDenseList(list))
+        {
+        }
+
+        Iterator begin()
+        {
+            return Iterator(ids, ids.size());
+        }
+        Iterator end()
+        {
+            return Iterator(ids, 0);
+        }
+    };
+
+    using VehicleList = DenseEntityList<Vehicles::VehicleHead, EntityListType::vehicleHead>;
+
+    // Iterates the entities on a tile using the compact spatial index arrays, optionally only yielding
+    // entities of a single base type so other entities are skipped without reading their records.
     class EntityTileList
     {
     private:
         EntityId firstId = EntityId::null;
-        using Iterator = ListIterator<EntityBase, &EntityBase::nextQuadrantId>;
+        std::optional<EntityBaseType> filter;
+
+        class Iterator
+        {
+        private:
+            EntityId entityId = EntityId::null;
+            std::optional<EntityBaseType> filter;
+
+            void skipFiltered()
+            {
+                if (!filter.has_value())
+                    return;
+
+                while (enumValue(entityId) < Limits::kMaxEntities && quadrantBaseType(entityId) != *filter)
+                {
+                    entityId = nextQuadrantId(entityId);
+                }
+            }
+
+        public:
+            Iterator(const EntityId id, std::optional<EntityBaseType> _filter)
+                : entityId(enumValue(id) < Limits::kMaxEntities ? id : EntityId::null)
+                , filter(_filter)
+            {
+                skipFiltered();
+            }
+
+            Iterator& operator++()
+            {
+                entityId = nextQuadrantId(entityId);
+                skipFiltered();
+                if (enumValue(entityId) >= Limits::kMaxEntities)
+                {
+                    entityId = EntityId::null;
+                }
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator retval = *this;
+                ++(*this);
+                return retval;
+            }
+            bool operator==(const Iterator& other) const
+            {
+                return entityId == other.entityId;
+            }
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+            EntityBase* operator*()
+            {
+                auto* entity = get<EntityBase>(entityId);
+                if (entity == nullptr)
+                {
+                    throw "Bad Entity List!";
+                }
+                return entity;
+            }
+            // iterator traits
+            using difference_type = std::ptrdiff_t;
+            using value_type = EntityBase;
+            using pointer = EntityBase*;
+            using reference = EntityBase&;
+            using iterator_category = std::forward_iterator_tag;
+        };
 
     public:
         EntityTileList(const Map::Pos2& loc)
@@ -155,13 +317,19 @@ namespace OpenLoco::EntityManager
             firstId = EntityManager::firstQuadrantId(loc);
         }
 
+        EntityTileList(const Map::Pos2& loc, EntityBaseType baseType)
+            : filter(baseType)
+        {
+            firstId = EntityManager::firstQuadrantId(loc);
+        }
+
         Iterator begin()
         {
-            return Iterator(firstId);
+            return Iterator(firstId, filter);
         }
         Iterator end()
         {
-            return Iterator(EntityId::null);
+            return Iterator(EntityId::null, std::nullopt);
         }
     };
 }
@@ -8,12 +8,11 @@
 namespace OpenLoco
 {
     using EntityListType = EntityManager::EntityListType;
-    using EntityListIterator = EntityManager::ListIterator<EntityBase, &EntityBase::nextThingId>;
 
     template<EntityListType id, typename Pred>
     void PopulateEntities(std::vector<EntityBase*>& list, std::vector<Map::Pos3>& posList, const Pred& pred)
     {
-        auto entsView = EntityManager::EntityList<EntityListIterator, id>();
+        auto entsView = EntityManager::DenseEntityList<EntityBase, id>();
         for (auto* ent : entsView)
         {
             if (!pred(ent))
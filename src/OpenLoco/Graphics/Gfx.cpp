@@ -1547,6 +1547,19 @@ namespace OpenLoco::Gfx
         }
     }
 
+    void ImageDrawBatch::draw(const Ui::Point& pos, const ImageId& image)
+    {
+        const auto colourBits = image.withIndex(0).toUInt32();
+        if (_colourBits != colourBits)
+        {
+            _colourBits = colourBits;
+            _noiseImage = getNoiseMaskImageFromImage(image);
+            const auto palette = getPaletteMapFromImage(image);
+            _palette = palette.has_value() ? *palette : PaletteMap::getDefault();
+        }
+        drawImagePaletteSet(_rt, pos, image, _palette, _noiseImage);
+    }
+
     uint32_t recolour(uint32_t image)
     {
         return ImageIdFlags::remap | image;
@@ -1588,6 +1601,112 @@ namespace OpenLoco::Gfx
         drawImagePaletteSet(rt, pos, image.withPrimary(Colour::black), PaletteMap{ palette }, {});
     }
 
+    // 0x00450705
+    void drawImageMasked(Gfx::RenderTarget& rt, const Ui::Point& pos, const ImageId& image, const ImageId& maskImage)
+    {
+        const auto* element = getG1Element(image.getIndex());
+        const auto* maskElement = getG1Element(maskImage.getIndex());
+        if (element == nullptr || maskElement == nullptr)
+        {
+            return;
+        }
+
+        if (rt.zoomLevel > 0)
+        {
+            if (element->flags & G1ElementFlags::noZoomDraw)
+            {
+                return;
+            }
+
+            if ((element->flags & G1ElementFlags::hasZoomSprites) && (maskElement->flags & G1ElementFlags::hasZoomSprites))
+            {
+                if (maskElement->flags & G1ElementFlags::noZoomDraw)
+                {
+                    return;
+                }
+
+                auto zoomedrt{ rt };
+                zoomedrt.x = rt.x >> 1;
+                zoomedrt.y = rt.y >> 1;
+                zoomedrt.height = rt.height >> 1;
+                zoomedrt.width = rt.width >> 1;
+                zoomedrt.zoomLevel = rt.zoomLevel - 1;
+
+                const auto zoomCoords = Ui::Point(pos.x >> 1, pos.y >> 1);
+                drawImageMasked(
+                    zoomedrt, zoomCoords, image.withIndexOffset(-element->zoomOffset), maskImage.withIndexOffset(-maskElement->zoomOffset));
+                return;
+            }
+        }
+
+        // Images are sampled every (1 << zoom) pixels, the mask shares the layout of the image
+        const int32_t zoom = std::min<int32_t>(rt.zoomLevel, 3);
+        const int32_t zoomMask = ~((1 << zoom) - 1);
+        const int32_t dstStride = (rt.width >> zoom) + rt.pitch;
+        const uint8_t* src = element->offset;
+        uint8_t* dst = rt.bits;
+        int32_t width = element->width;
+        int32_t height = element->height;
+
+        int32_t top = ((pos.y + element->yOffset) & zoomMask) - rt.y;
+        if (top < 0)
+        {
+            height += top;
+            if (height <= 0)
+            {
+                return;
+            }
+            src -= top * element->width;
+            top = 0;
+        }
+        else
+        {
+            dst += (top >> zoom) * dstStride;
+        }
+        height -= std::max(0, top + height - rt.height);
+        if (height <= 0)
+        {
+            return;
+        }
+
+        int32_t left = ((pos.x + element->xOffset + (1 << zoom) - 1) & zoomMask) - rt.x;
+        if (left < 0)
+        {
+            width += left;
+            if (width <= 0)
+            {
+                return;
+            }
+            src -= left;
+            left = 0;
+        }
+        dst += left >> zoom;
+        width -= std::max(0, left + width - rt.width);
+        if (width <= 0)
+        {
+            return;
+        }
+
+        const uint8_t* mask = maskElement->offset + (src - element->offset);
+        const int32_t rows = height >> zoom;
+        const int32_t columns = width >> zoom;
+        const int32_t srcStride = element->width << zoom;
+        for (int32_t y = 0; y < rows; y++)
+        {
+            for (int32_t x = 0; x < columns; x++)
+            {
+                const auto colour = src[x << zoom] & mask[x << zoom];
+                if (colour != 0)
+                {
+                    dst[x] = colour;
+                }
+            }
+            src += srcStride;
+            mask += srcStride;
+            dst += dstStride;
+        }
+    }
+
     template<uint8_t TZoomLevel, bool TIsRLE>
     static std::optional<DrawSpritePosArgs> getDrawImagePosArgs(Gfx::RenderTarget& rt, const Ui::Point& pos, const G1Element& element)
     {
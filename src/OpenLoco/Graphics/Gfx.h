@@ -5,6 +5,7 @@
 #include "../Ui/Rect.h"
 #include "../Ui/Types.hpp"
 #include "ImageId.h"
+#include "PaletteMap.h"
 #include <array>
 #include <cstdint>
 
@@ -194,7 +195,27 @@ namespace OpenLoco::Gfx
     void drawImage(Gfx::RenderTarget* rt, int16_t x, int16_t y, uint32_t image);
     void drawImage(Gfx::RenderTarget& rt, const Ui::Point& pos, const ImageId& image);
     void drawImageSolid(Gfx::RenderTarget& rt, const Ui::Point& pos, const ImageId& image, PaletteIndex_t paletteIndex);
+    void drawImageMasked(Gfx::RenderTarget& rt, const Ui::Point& pos, const ImageId& image, const ImageId& maskImage);
     void drawImagePaletteSet(Gfx::RenderTarget& rt, const Ui::Point& pos, const ImageId& image, const PaletteMap& palette, const G1Element* noiseImage);
+
+    // Draws a run of images into the same render target, only resolving the palette map and noise
+    // mask again when the colour bits of the image change. Consecutive paint structs usually share them.
+    class ImageDrawBatch
+    {
+    private:
+        Gfx::RenderTarget& _rt;
+        std::optional<uint32_t> _colourBits;
+        PaletteMap _palette;
+        const G1Element* _noiseImage = nullptr;
+
+    public:
+        explicit ImageDrawBatch(Gfx::RenderTarget& rt)
+            : _rt(rt)
+        {
+        }
+
+        void draw(const Ui::Point& pos, const ImageId& image);
+    };
     [[nodiscard]] uint32_t recolour(uint32_t image);
     [[nodiscard]] uint32_t recolour(uint32_t image, Colour colour);
     [[nodiscard]] uint32_t recolour(uint32_t image, ExtColour colour);
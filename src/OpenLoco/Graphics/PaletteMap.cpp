@@ -15,14 +15,11 @@ namespace OpenLoco::Gfx
 
     const PaletteMap& PaletteMap::getDefault()
     {
-        static bool initialised = false;
         static uint8_t data[256];
-        static PaletteMap defaultMap(data);
-        if (!initialised)
-        {
+        static PaletteMap defaultMap = [] {
             std::iota(std::begin(data), std::end(data), 0);
-            initialised = true;
-        }
+            return PaletteMap(data);
+        }();
         return defaultMap;
     }
 
@@ -103,8 +100,11 @@ namespace OpenLoco::Gfx
 
         if (image.hasSecondary())
         {
-            // A secondary paletteMap is made up by combinging bits from two palettes.
-            PaletteMap customMap = PaletteMap::getDefault();
+            // A secondary paletteMap is made up by combinging bits from two palettes. It is built in a buffer
+            // of its own as viewport strips are drawn on several threads at once.
+            thread_local uint8_t customData[256];
+            std::copy_n(PaletteMap::getDefault().data(), std::size(customData), customData);
+            PaletteMap customMap(customData);
             const auto primaryMap = getPaletteMapForColour(Colours::toExt(image.getPrimary()));
             const auto secondaryMap = getPaletteMapForColour(Colours::toExt(image.getSecondary()));
             if (!primaryMap || !secondaryMap)
@@ -884,6 +884,86 @@ void OpenLoco::Interop::registerHooks()
     // vehicles that are using it.
     writeNop(0x004776DD, 6);
 
+    // Route the vanilla spatial index, entity list and entity creation functions through our
+    // implementations so the compact spatial index and dense list arrays stay in sync.
+    registerHook(
+        0x0046FC83,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+
+            EntityBase* entity = X86Pointer<EntityBase>(regs.esi);
+            entity->moveTo({ regs.ax, regs.cx, regs.dx });
+
+            regs = backup;
+            return 0;
+        });
+
+    registerHook(
+        0x004700A5,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            auto* entity = EntityManager::createEntityMisc();
+            regs = backup;
+            regs.esi = X86Pointer(entity);
+            return entity != nullptr ? 0 : X86_FLAG_ZERO;
+        });
+
+    registerHook(
+        0x0047011C,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            auto* entity = EntityManager::createEntityMoney();
+            regs = backup;
+            regs.esi = X86Pointer(entity);
+            return entity != nullptr ? 0 : X86_FLAG_ZERO;
+        });
+
+    registerHook(
+        0x00470039,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            auto* entity = EntityManager::createEntityVehicle();
+            regs = backup;
+            regs.esi = X86Pointer(entity);
+            return entity != nullptr ? 0 : X86_FLAG_ZERO;
+        });
+
+    registerHook(
+        0x0047019F,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            EntityManager::moveEntityToList(X86Pointer<EntityBase>(regs.esi), static_cast<EntityManager::EntityListType>(regs.cl / 2));
+            regs = backup;
+            return 0;
+        });
+
+    registerHook(
+        0x0046FDFD,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            EntityManager::reset();
+            regs = backup;
+            return 0;
+        });
+
+    registerHook(
+        0x0046FF54,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            EntityManager::resetSpatialIndex();
+            regs = backup;
+            return 0;
+        });
+
+    registerHook(
+        0x0046FC57,
+        [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+            registers backup = regs;
+            EntityManager::updateSpatialIndex();
+            regs = backup;
+            return 0;
+        });
+
     registerHook(
         0x0047024A,
         [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
@@ -112,6 +112,7 @@ namespace OpenLoco::StringIds
     constexpr string_id menu_screenshot = 108;
     constexpr string_id screenshot_saved_as = 109;
     constexpr string_id screenshot_failed = 110;
+    constexpr string_id landscape_data_area_full = 111;
 
     constexpr string_id stringid_2 = 113;
     constexpr string_id tooltip_left_hand_curve = 114;
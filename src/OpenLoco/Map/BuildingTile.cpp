@@ -86,6 +86,13 @@ namespace OpenLoco::Map
 
                     TownManager::sub_497DC1(loc, buildingObj->producedQuantity[0], 0, 0, 0);
 
+                    // Completed buildings start accepting and producing cargo
+                    const auto numTiles = (buildingObj->flags & BuildingObjectFlags::largeTile) ? 4 : 1;
+                    for (auto i = 0; i < numTiles; ++i)
+                    {
+                        StationManager::invalidateAcceptance(TilePos2(loc + Map::offsets[i]));
+                    }
+
                     newUnk5u = 0;
                     newAge = 0;
                     isConstructed = true;
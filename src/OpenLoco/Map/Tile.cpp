@@ -5,6 +5,7 @@
 #include "../Objects/ObjectManager.h"
 #include "../Station.h"
 #include "../Ui/WindowManager.h"
+#include "TileManager.h"
 #include <cassert>
 
 using namespace OpenLoco;
@@ -108,6 +109,11 @@ SurfaceElement* Tile::surface() const
 
 StationElement* Tile::trackStation(uint8_t trackId, uint8_t direction, uint8_t baseZ) const
 {
+    if (!TileManager::hasElementOfType(pos, ElementType::station))
+    {
+        return nullptr;
+    }
+
     StationElement* result = nullptr;
     bool trackFound = false;
     for (auto& tile : *this)
@@ -139,6 +145,11 @@ StationElement* Tile::trackStation(uint8_t trackId, uint8_t direction, uint8_t b
 
 StationElement* Tile::roadStation(uint8_t roadId, uint8_t direction, uint8_t baseZ) const
 {
+    if (!TileManager::hasElementOfType(pos, ElementType::station))
+    {
+        return nullptr;
+    }
+
     StationElement* result = nullptr;
     bool trackFound = false;
     for (auto& tile : *this)
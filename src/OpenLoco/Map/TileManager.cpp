@@ -3,17 +3,22 @@
 #include "../CompanyManager.h"
 #include "../Entities/Misc.h"
 #include "../Game.h"
+#include "../GameCommands/GameCommands.h"
 #include "../GameState.h"
 #include "../IndustryManager.h"
 #include "../Input.h"
 #include "../Interop/Interop.hpp"
+#include "../Localisation/StringIds.h"
 #include "../Map/Map.hpp"
 #include "../Objects/BuildingObject.h"
 #include "../OpenLoco.h"
+#include "../Station.h"
+#include "../StationManager.h"
 #include "../TownManager.h"
 #include "../Ui.h"
 #include "../ViewportManager.h"
 #include "QuarterTile.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -37,6 +42,108 @@ namespace OpenLoco::Map::TileManager
 
     static TileElement* InvalidTile = reinterpret_cast<TileElement*>(static_cast<intptr_t>(-1));
 
+    // Bit mask of the element types present on each tile, see getTileTypeMask
+    static std::array<uint16_t, kMapSize> _tileTypeMasks;
+    constexpr uint16_t kTileTypeMaskStale = 1 << 15;
+
+    static void markTileTypeMaskStale(const TilePos2& pos)
+    {
+        _tileTypeMasks[pos.y * kMapColumns + pos.x] = kTileTypeMaskStale;
+    }
+
+    // Runs of free element slots (baseZ 0xFF) inside the pool left behind by moved tiles. Insertions reuse
+    // these before growing the pool. Entries may go stale when the compactor moves a tile over them, so a
+    // run is always validated before use.
+    struct FreeRun
+    {
+        uint32_t index;
+        uint32_t length;
+    };
+    static std::vector<FreeRun> _freeRuns;
+    constexpr size_t kMaxFreeRuns = 4096;
+
+    // Number of tiles compacted per tick, vanilla only did one
+    constexpr uint32_t kTilesCompactedPerTick = 64;
+
+    // The pool is considered full when the end is within this many elements of maxElements
+    constexpr size_t kElementsReserve = 0x400;
+
+    static void addFreeRun(uint32_t index, uint32_t length)
+    {
+        if (length == 0 || _freeRuns.size() >= kMaxFreeRuns)
+            return;
+
+        _freeRuns.push_back(FreeRun{ index, length });
+    }
+
+    static bool isFreeRunValid(const FreeRun& run)
+    {
+        if (run.index + run.length > static_cast<uint32_t>(_elementsEnd - _elements))
+            return false;
+
+        const TileElement* el = _elements + run.index;
+        for (uint32_t i = 0; i < run.length; i++)
+        {
+            if (el[i].baseZ() != 0xFF)
+                return false;
+        }
+        return true;
+    }
+
+    // Returns space for count elements, either from a free run or from the end of the pool.
+    static TileElement* allocateElements(uint32_t count)
+    {
+        for (auto it = _freeRuns.begin(); it != _freeRuns.end();)
+        {
+            if (!isFreeRunValid(*it))
+            {
+                *it = _freeRuns.back();
+                _freeRuns.pop_back();
+                continue;
+            }
+
+            if (it->length >= count)
+            {
+                auto* result = _elements + it->index;
+                it->index += count;
+                it->length -= count;
+                if (it->length == 0)
+                {
+                    *it = _freeRuns.back();
+                    _freeRuns.pop_back();
+                }
+                return result;
+            }
+            it++;
+        }
+
+        auto* result = *_elementsEnd;
+        _elementsEnd = result + count;
+        return result;
+    }
+
+    static uint32_t countTileElements(const TileElement* el)
+    {
+        uint32_t count = 1;
+        while (!el->isLast())
+        {
+            el++;
+            count++;
+        }
+        return count;
+    }
+
+    // Moves _elementsEnd back past any free slots at the end of the pool
+    static void trimElementsEnd()
+    {
+        TileElement* end = _elementsEnd;
+        while (end > _elements && (end - 1)->baseZ() == 0xFF)
+        {
+            end--;
+        }
+        _elementsEnd = end;
+    }
+
     // 0x0046902E
     void removeSurfaceIndustry(const Pos2& pos)
     {
@@ -128,6 +235,22 @@ namespace OpenLoco::Map::TileManager
     // 0x00461760
     void removeElement(TileElement& element)
     {
+        if (!element.isGhost())
+        {
+            if (auto* elStation = element.as<StationElement>())
+            {
+                StationManager::invalidateCatchment(elStation->stationId());
+            }
+            else if (auto* elIndustry = element.as<IndustryElement>())
+            {
+                auto* industry = elIndustry->industry();
+                if (industry != nullptr)
+                {
+                    StationManager::invalidateAcceptance(*industry);
+                }
+            }
+        }
+
         // This is used to indicate if the caller can still use this pointer
         if (&element == *_F00158)
         {
@@ -157,20 +280,138 @@ namespace OpenLoco::Map::TileManager
         }
     }
 
+    // Moves all elements of the tile to a free run or the end of the element pool, inserting a new element in
+    // front of the first element for which insertBefore returns true. The old slots are left free (baseZ 0xFF)
+    // like vanilla and are recorded for reuse. The type of the new element is left for the caller to set.
+    template<typename TFunc>
+    static TileElement* insertElementOnTile(const TilePos2& pos, uint8_t baseZ, uint8_t flags, TFunc&& insertBefore)
+    {
+        auto& tile = _tiles[(pos.y * kMapPitch) + pos.x];
+        TileElement* source = tile;
+        const auto numElements = countTileElements(source);
+        TileElement* dest = allocateElements(numElements + 1);
+        tile = dest;
+        const auto oldIndex = static_cast<uint32_t>(source - _elements);
+
+        bool isLast = false;
+        while (!insertBefore(*source))
+        {
+            *dest = *source;
+            source->setBaseZ(0xFF);
+            source++;
+            dest++;
+            if ((dest - 1)->isLast())
+            {
+                (dest - 1)->setLastFlag(false);
+                isLast = true;
+                break;
+            }
+        }
+
+        auto* newElement = dest++;
+        auto& raw = newElement->rawData();
+        raw[1] = flags | (isLast ? ElementFlags::last : 0);
+        std::fill(raw.begin() + 4, raw.end(), 0);
+        newElement->setBaseZ(baseZ);
+        newElement->setClearZ(baseZ);
+
+        if (!isLast)
+        {
+            do
+            {
+                *dest = *source;
+                source->setBaseZ(0xFF);
+                source++;
+                dest++;
+            } while (!(dest - 1)->isLast());
+        }
+        addFreeRun(oldIndex, numElements);
+
+        // The caller has yet to set the type of the new element
+        markTileTypeMaskStale(pos);
+        StationManager::queueAcceptanceCheck(pos);
+        return newElement;
+    }
+
     // 0x004616D6
+    static TileElement* insertElementByHeight(const Pos2& pos, uint8_t baseZ, uint8_t flags)
+    {
+        checkFreeElementsAndReorganise();
+        return insertElementOnTile(TilePos2(pos), baseZ, flags, [baseZ](const TileElement& el) {
+            return baseZ < el.baseZ();
+        });
+    }
+
+    // 0x00461578
+    static TileElement* insertElementAfter(const Pos2& pos, uint8_t baseZ, uint8_t flags, const TileElement* previous)
+    {
+        return insertElementOnTile(TilePos2(pos), baseZ, flags, [previous](const TileElement& el) {
+            return &el > previous;
+        });
+    }
+
+    // 0x00461600
+    static TileElement* insertElementBeforeStation(const Pos2& pos, uint8_t baseZ, uint8_t flags)
+    {
+        checkFreeElementsAndReorganise();
+        return insertElementOnTile(TilePos2(pos), baseZ, flags, [baseZ](const TileElement& el) {
+            if (baseZ != el.baseZ())
+            {
+                return baseZ < el.baseZ();
+            }
+            return !el.isFlag5() && el.type() == ElementType::station;
+        });
+    }
+
+    // 0x0046166C
+    static TileElement* insertElementBeforeRoadStation(const Pos2& pos, uint8_t baseZ, uint8_t flags)
+    {
+        checkFreeElementsAndReorganise();
+        return insertElementOnTile(TilePos2(pos), baseZ, flags, [baseZ](const TileElement& el) {
+            if (baseZ != el.baseZ())
+            {
+                return baseZ < el.baseZ();
+            }
+            auto* elStation = el.as<StationElement>();
+            return elStation != nullptr && elStation->stationType() == StationType::roadStation;
+        });
+    }
+
     TileElement* insertElement(ElementType type, const Pos2& pos, uint8_t baseZ, uint8_t occupiedQuads)
     {
-        registers regs;
-        regs.ax = pos.x;
-        regs.cx = pos.y;
-        regs.bl = baseZ;
-        regs.bh = occupiedQuads;
-        call(0x004616D6, regs);
-        TileElement* el = X86Pointer<TileElement>(regs.esi);
+        auto* el = insertElementByHeight(pos, baseZ, occupiedQuads);
         el->setType(type);
         return el;
     }
 
+    uint16_t getTileTypeMask(const TilePos2& pos)
+    {
+        if (!validCoords(pos))
+        {
+            return 0;
+        }
+
+        auto& mask = _tileTypeMasks[pos.y * kMapColumns + pos.x];
+        if (mask & kTileTypeMaskStale)
+        {
+            mask = 0;
+            const auto tile = get(pos);
+            if (!tile.isNull())
+            {
+                for (const auto& el : tile)
+                {
+                    mask |= 1 << enumValue(el.type());
+                }
+            }
+        }
+        return mask;
+    }
+
+    bool hasElementOfType(const TilePos2& pos, ElementType type)
+    {
+        return (getTileTypeMask(pos) & (1 << enumValue(type))) != 0;
+    }
+
     TileElement** getElementIndex()
     {
         return _tiles.get();
@@ -398,6 +639,8 @@ namespace OpenLoco::Map::TileManager
     void updateTilePointers()
     {
         clearTilePointers();
+        std::fill(_tileTypeMasks.begin(), _tileTypeMasks.end(), kTileTypeMaskStale);
+        _freeRuns.clear();
 
         TileElement* el = _elements;
         for (tile_coord_t y = 0; y < kMapRows; y++)
@@ -426,7 +669,7 @@ namespace OpenLoco::Map::TileManager
         {
             // Allocate a temporary buffer and tighly pack all the tile elements in the map
             std::vector<TileElement> tempBuffer;
-            tempBuffer.resize(maxElements * sizeof(TileElement));
+            tempBuffer.resize(maxElements);
 
             size_t numElements = 0;
             for (tile_coord_t y = 0; y < kMapRows; y++)
@@ -462,10 +705,109 @@ namespace OpenLoco::Map::TileManager
         }
     }
 
+    static bool isElementPoolFull()
+    {
+        return *_elementsEnd > *_elements + (maxElements - kElementsReserve);
+    }
+
+    // Moves the tile over any free slots directly in front of it. If the tile is the last one in the pool
+    // it is instead moved into the first free run that fits so the end of the pool can shrink.
+    static void compactTile(TileElement*& tile)
+    {
+        TileElement* source = tile;
+        TileElement* dest = source;
+        while (dest > _elements && (dest - 1)->baseZ() == 0xFF)
+        {
+            dest--;
+        }
+
+        const auto numElements = countTileElements(source);
+        if (source + numElements == _elementsEnd && !_freeRuns.empty())
+        {
+            // Release the tile and everything after the slide position, if no free run fits the
+            // allocator hands back the slide position itself
+            _elementsEnd = dest;
+            dest = allocateElements(numElements);
+            _elementsEnd = source + numElements;
+        }
+
+        if (dest == source)
+            return;
+
+        tile = dest;
+        for (uint32_t i = 0; i < numElements; i++)
+        {
+            dest[i] = source[i];
+        }
+
+        // Free the old slots that were not overwritten by the moved tile
+        auto* freeBegin = std::max(source, dest + numElements);
+        auto* freeEnd = source + numElements;
+        for (auto* el = freeBegin; el < freeEnd; el++)
+        {
+            el->setBaseZ(0xFF);
+        }
+        addFreeRun(static_cast<uint32_t>(freeBegin - _elements), static_cast<uint32_t>(freeEnd - freeBegin));
+        trimElementsEnd();
+    }
+
+    static void compactNextTile()
+    {
+        // Find the next tile in round robin order
+        uint32_t index = _F00168;
+        for (uint32_t i = 0; i < kMapPitch * kMapRows; i++)
+        {
+            index = (index + 1) % (kMapPitch * kMapRows);
+            if (_tiles[index] != InvalidTile)
+                break;
+        }
+        _F00168 = index;
+
+        compactTile(_tiles[index]);
+    }
+
+    // 0x004613F0
+    // Compacts a bounded number of tiles, called every tick so the pool rarely needs a full reorganise
+    void compactElements(uint32_t numTiles)
+    {
+        if (!(getGameState().flags & (1u << 0)))
+            return;
+
+        // Set when loading the title sequence, skips the whole pass rather than a single tile
+        auto& skipCompaction = addr<0x0050BF6C, uint8_t>();
+        if (skipCompaction != 0)
+        {
+            skipCompaction = 0;
+            return;
+        }
+
+        for (uint32_t i = 0; i < numTiles; i++)
+        {
+            compactNextTile();
+        }
+    }
+
+    void compactElements()
+    {
+        compactElements(kTilesCompactedPerTick);
+    }
+
     // 0x00461393
     bool checkFreeElementsAndReorganise()
     {
-        return !(call(0x00461393) & Interop::X86_FLAG_CARRY);
+        if (!isElementPoolFull())
+            return true;
+
+        compactElements(1000);
+        if (!isElementPoolFull())
+            return true;
+
+        reorganise();
+        if (!isElementPoolFull())
+            return true;
+
+        GameCommands::setErrorText(StringIds::landscape_data_area_full);
+        return false;
     }
 
     // 0x00462926
@@ -840,6 +1182,10 @@ namespace OpenLoco::Map::TileManager
                 }
             }
         }
+        if (!elBuilding.isGhost())
+        {
+            StationManager::invalidateAcceptance(TilePos2(pos));
+        }
         Ui::ViewportManager::invalidate(pos, elBuilding.baseHeight(), elBuilding.clearHeight(), ZoomLevel::eighth);
         TileManager::removeElement(*reinterpret_cast<TileElement*>(&elBuilding));
     }
@@ -852,6 +1198,101 @@ namespace OpenLoco::Map::TileManager
 
     void registerHooks()
     {
+        // Route all vanilla element insertions through our implementations so the tile type masks stay valid
+        registerHook(
+            0x004616D6,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                auto* el = insertElementByHeight(Pos2(regs.ax, regs.cx), regs.bl, regs.bh);
+                regs = backup;
+                regs.esi = X86Pointer(el);
+                return 0;
+            });
+
+        registerHook(
+            0x00461578,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                auto* el = insertElementAfter(Pos2(regs.ax, regs.cx), regs.bl, regs.bh, X86Pointer<TileElement>(regs.esi));
+                regs = backup;
+                regs.esi = X86Pointer(el);
+                return 0;
+            });
+
+        registerHook(
+            0x00461600,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                auto* el = insertElementBeforeStation(Pos2(regs.ax, regs.cx), regs.bl, regs.bh);
+                regs = backup;
+                regs.esi = X86Pointer(el);
+                return 0;
+            });
+
+        registerHook(
+            0x0046166C,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                auto* el = insertElementBeforeRoadStation(Pos2(regs.ax, regs.cx), regs.bl, regs.bh);
+                regs = backup;
+                regs.esi = X86Pointer(el);
+                return 0;
+            });
+
+        registerHook(
+            0x00461348,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                updateTilePointers();
+                regs = backup;
+                return 0;
+            });
+
+        // Route vanilla element removals through our implementations so stations see their catchment change
+        registerHook(
+            0x00461760,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                TileElement* el = X86Pointer<TileElement>(regs.esi);
+                // Vanilla returns the slot after the one that was freed, which is the last element of the tile
+                auto* last = el;
+                while (!last->isLast())
+                {
+                    last++;
+                }
+                removeElement(*el);
+                regs = backup;
+                regs.esi = X86Pointer(last + 1);
+                return 0;
+            });
+
+        registerHook(
+            0x0042D8FF,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                removeBuildingElement(*X86Pointer<BuildingElement>(regs.esi), Pos2(regs.ax, regs.cx));
+                regs = backup;
+                return 0;
+            });
+
+        registerHook(
+            0x004613F0,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                compactElements(1);
+                regs = backup;
+                return 0;
+            });
+
+        registerHook(
+            0x00461393,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                const bool hasFreeElements = checkFreeElementsAndReorganise();
+                regs = backup;
+                return hasFreeElements ? 0 : X86_FLAG_CARRY;
+            });
+
         // This hook can be removed once sub_4599B3 has been implemented
         registerHook(
             0x004BE048,
@@ -2,6 +2,7 @@
 
 #include "../Core/Span.hpp"
 #include "Tile.h"
+#include <algorithm>
 #include <cstdint>
 #include <tuple>
 
@@ -30,9 +31,45 @@ namespace OpenLoco::Map::TileManager
     {
         return insertElement(TileT::kElementType, pos, baseZ, occupiedQuads)->template as<TileT>();
     }
+
+    // Returns a bit mask with (1 << ElementType) set for every type of element on the tile.
+    uint16_t getTileTypeMask(const TilePos2& pos);
+    bool hasElementOfType(const TilePos2& pos, ElementType type);
+
+    // Calls func(element, tilePos) for every element of type TileT in the inclusive area,
+    // skipping tiles that have no such element without walking them.
+    template<typename TileT, typename TFunc>
+    void forEachElementInArea(const TilePos2& min, const TilePos2& max, TFunc&& func)
+    {
+        const auto typeBit = 1 << enumValue(TileT::kElementType);
+        const auto xEnd = std::min<coord_t>(max.x, kMapColumns - 1);
+        const auto yEnd = std::min<coord_t>(max.y, kMapRows - 1);
+        for (auto y = std::max<coord_t>(min.y, 0); y <= yEnd; ++y)
+        {
+            for (auto x = std::max<coord_t>(min.x, 0); x <= xEnd; ++x)
+            {
+                const TilePos2 pos(x, y);
+                if (!(getTileTypeMask(pos) & typeBit))
+                {
+                    continue;
+                }
+                for (auto& el : get(pos))
+                {
+                    auto* elType = el.template as<TileT>();
+                    if (elType != nullptr)
+                    {
+                        func(*elType, pos);
+                    }
+                }
+            }
+        }
+    }
+
     TileHeight getHeight(const Pos2& pos);
     void updateTilePointers();
     void reorganise();
+    void compactElements(uint32_t numTiles);
+    void compactElements();
     bool checkFreeElementsAndReorganise();
     bool canConstructAt(const Map::Pos2& pos, uint8_t baseZ, uint8_t clearZ, const QuarterTile& qt);
     uint16_t setMapSelectionTiles(const Map::Pos2& loc, const uint8_t selectionType);
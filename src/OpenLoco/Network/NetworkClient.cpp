@@ -4,6 +4,7 @@
 #include "../GameCommands/GameCommands.h"
 #include "../Platform/Platform.h"
 #include "../S5/S5.h"
+#include "../ScenarioManager.h"
 #include "../SceneManager.h"
 #include "../Ui/WindowManager.h"
 #include "../Utility/Stream.hpp"
@@ -12,6 +13,9 @@
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
 
+// Number of ticks a local state hash is kept while waiting for the server hash of the same tick
+static constexpr uint32_t kMaxStateHashAge = kStateHashInterval * 4;
+
 NetworkClient::~NetworkClient()
 {
     close();
@@ -68,6 +72,7 @@ void NetworkClient::onClose()
 void NetworkClient::onUpdate()
 {
     processReceivedPackets();
+    sendGameCommands();
     if (_status == NetworkClientStatus::connecting)
     {
         if (Platform::getTime() >= _timeout)
@@ -173,6 +178,12 @@ void NetworkClient::onReceivePacketFromServer(const Packet& packet)
         case PacketKind::gameCommand:
             receiveGameCommandPacket(*reinterpret_cast<const GameCommandPacket*>(packet.data));
             break;
+        case PacketKind::gameCommandBatch:
+            receiveGameCommandBatchPacket(*reinterpret_cast<const GameCommandBatchPacket*>(packet.data));
+            break;
+        case PacketKind::stateHash:
+            receiveStateHashPacket(*reinterpret_cast<const StateHashPacket*>(packet.data));
+            break;
         default:
             break;
     }
@@ -190,7 +201,10 @@ void NetworkClient::sendConnectPacket()
 void NetworkClient::sendRequestStatePacket()
 {
     _requestStateCookie = (std::rand() << 16) | std::rand();
+    _requestStateTotalSize = 0;
+    _requestStateData.clear();
     _requestStateChunksReceived.clear();
+    _requestStateReceivedBytes = 0;
 
     RequestStatePacket packet;
     packet.cookie = _requestStateCookie;
@@ -213,48 +227,62 @@ void NetworkClient::receiveConnectionResponsePacket(const ConnectResponsePacket&
 
 void NetworkClient::receiveRequestStateResponsePacket(const RequestStateResponse& response)
 {
+    // The response can arrive after the chunks, or be resent after the state has been received
+    if (_status != NetworkClientStatus::waitingForState)
+    {
+        return;
+    }
+
     if (response.cookie == _requestStateCookie)
     {
-        _requestStateNumChunks = response.numChunks;
         _requestStateTotalSize = response.totalSize;
-        _requestStateReceivedChunks = 0;
+        _requestStateData.resize(response.totalSize);
+        _requestStateChunksReceived.resize(response.numChunks);
     }
 }
 
 void NetworkClient::receiveRequestStateResponseChunkPacket(const RequestStateResponseChunk& responseChunk)
 {
-    if (responseChunk.cookie == _requestStateCookie)
+    // Chunks are resent until they are acknowledged, so duplicates can still arrive after the state is complete
+    if (_status != NetworkClientStatus::waitingForState || responseChunk.cookie != _requestStateCookie)
     {
-        if (_requestStateChunksReceived.size() <= responseChunk.index)
-        {
-            _requestStateChunksReceived.resize(responseChunk.index + 1);
-        }
-
-        auto& rchunk = _requestStateChunksReceived[responseChunk.index];
-        if (rchunk.data.size() == 0)
-        {
-            rchunk.offset = responseChunk.offset;
-            rchunk.data.assign(responseChunk.data, responseChunk.data + responseChunk.dataSize);
-            _requestStateReceivedChunks++;
+        return;
+    }
 
-            _requestStateReceivedBytes += responseChunk.dataSize;
-            setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
-        }
+    // Chunks can arrive before the response, so they carry the total size as well
+    _requestStateTotalSize = responseChunk.totalSize;
+    _requestStateData.resize(_requestStateTotalSize);
+    if (responseChunk.dataSize > sizeof(responseChunk.data) || responseChunk.offset > _requestStateTotalSize || responseChunk.dataSize > _requestStateTotalSize - responseChunk.offset)
+    {
+        return;
+    }
 
-        if (_requestStateReceivedChunks >= _requestStateNumChunks)
-        {
-            // Construct full data
-            std::vector<uint8_t> fullData;
-            for (size_t i = 0; i < _requestStateChunksReceived.size(); i++)
-            {
-                fullData.insert(fullData.end(), _requestStateChunksReceived[i].data.begin(), _requestStateChunksReceived[i].data.end());
-            }
+    if (_requestStateChunksReceived.size() <= responseChunk.index)
+    {
+        _requestStateChunksReceived.resize(responseChunk.index + 1);
+    }
+    if (!_requestStateChunksReceived[responseChunk.index])
+    {
+        // Chunks are written straight into the final buffer, so there is nothing to reassemble at the end
+        _requestStateChunksReceived[responseChunk.index] = true;
+        std::memcpy(_requestStateData.data() + responseChunk.offset, responseChunk.data, responseChunk.dataSize);
 
-            clearStatus();
-            _status = NetworkClientStatus::connected;
+        _requestStateReceivedBytes += responseChunk.dataSize;
+        setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
+    }
 
-            processFullState(fullData);
-        }
+    if (_requestStateReceivedBytes >= _requestStateTotalSize)
+    {
+        clearStatus();
+        _status = NetworkClientStatus::connected;
+
+        auto fullData = std::move(_requestStateData);
+        _requestStateCookie = 0;
+        _requestStateTotalSize = 0;
+        _requestStateData.clear();
+        _requestStateChunksReceived.clear();
+        _requestStateReceivedBytes = 0;
+        processFullState(fullData);
     }
 }
 
@@ -318,6 +346,65 @@ void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
     updateLocalTick();
 }
 
+void NetworkClient::receiveGameCommandBatchPacket(const GameCommandBatchPacket& packet)
+{
+    for (const auto& command : packet.read())
+    {
+        receiveGameCommandPacket(command);
+    }
+}
+
+void NetworkClient::receiveStateHashPacket(const StateHashPacket& packet)
+{
+    if (_status != NetworkClientStatus::connected)
+        return;
+
+    _serverStateHashes[packet.tick] = packet.hash;
+    checkStateHashes();
+}
+
+// Compares the hashes computed locally with the ones received from the server for the same tick.
+// Either of them can be the first to be available.
+void NetworkClient::checkStateHashes()
+{
+    const auto currentTick = ScenarioManager::getScenarioTicks();
+    for (auto it = _serverStateHashes.begin(); it != _serverStateHashes.end();)
+    {
+        auto localHash = _localStateHashes.find(it->first);
+        if (localHash != _localStateHashes.end())
+        {
+            if (!_hasDesynced && !compareStateHash(it->first, localHash->second, it->second))
+            {
+                _hasDesynced = true;
+            }
+            _localStateHashes.erase(localHash);
+            it = _serverStateHashes.erase(it);
+        }
+        else if (it->first <= currentTick)
+        {
+            // Tick was before the state was received, there is nothing to compare it with
+            it = _serverStateHashes.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    // Drop local hashes that never got a server hash, e.g. those computed before the first one arrived
+    for (auto it = _localStateHashes.begin(); it != _localStateHashes.end();)
+    {
+        if (it->first + kMaxStateHashAge < currentTick)
+        {
+            it = _localStateHashes.erase(it);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
 void NetworkClient::sendChatMessage(std::string_view message)
 {
     if (_serverConnection != nullptr)
@@ -333,13 +420,24 @@ void NetworkClient::sendGameCommand(CompanyId company, const OpenLoco::Interop::
 {
     if (_serverConnection != nullptr && _status == NetworkClientStatus::connected)
     {
-        GameCommandPacket packet;
-        packet.company = company;
-        packet.regs = regs;
-        _serverConnection->sendPacket(packet);
+        // Commands are collected and sent together on the next update
+        if (!_outgoingGameCommands.add(company, regs))
+        {
+            sendGameCommands();
+            _outgoingGameCommands.add(company, regs);
+        }
     }
 }
 
+void NetworkClient::sendGameCommands()
+{
+    if (_serverConnection != nullptr && _outgoingGameCommands.count != 0)
+    {
+        _serverConnection->sendPacket(_outgoingGameCommands);
+    }
+    _outgoingGameCommands = {};
+}
+
 void NetworkClient::updateLocalTick()
 {
     // If we have the next game command, we can set local tick to the tick for that command
@@ -383,6 +481,12 @@ void NetworkClient::runGameCommandsForTick(uint32_t tick)
         }
     }
 
+    if (shouldHashState(tick))
+    {
+        _localStateHashes[tick] = computeStateHash();
+        checkStateHashes();
+    }
+
     updateLocalTick();
 }
 
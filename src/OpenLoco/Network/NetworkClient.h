@@ -4,8 +4,10 @@
 #include "Network.h"
 #include "NetworkBase.h"
 #include "Socket.h"
+#include "StateHash.h"
 #include <cstdint>
 #include <list>
+#include <map>
 #include <vector>
 
 namespace OpenLoco::Network
@@ -34,19 +36,16 @@ namespace OpenLoco::Network
         uint32_t _localTick;
         uint32_t _serverTick;
         std::list<GameCommandPacket> _receivedGameCommands;
-
-        struct ReceivedChunk
-        {
-            uint32_t offset{};
-            std::vector<uint8_t> data;
-        };
+        GameCommandBatchPacket _outgoingGameCommands;
+        std::map<uint32_t, StateHash> _localStateHashes;
+        std::map<uint32_t, StateHash> _serverStateHashes;
+        bool _hasDesynced{};
 
         uint32_t _requestStateCookie{};
         uint32_t _requestStateTotalSize{};
-        uint16_t _requestStateNumChunks{};
-        std::vector<ReceivedChunk> _requestStateChunksReceived;
+        std::vector<uint8_t> _requestStateData;
+        std::vector<bool> _requestStateChunksReceived;
         uint32_t _requestStateReceivedBytes{};
-        uint32_t _requestStateReceivedChunks{};
 
         void onCancel();
         void processReceivedPackets();
@@ -62,6 +61,7 @@ namespace OpenLoco::Network
 
         void sendConnectPacket();
         void sendRequestStatePacket();
+        void sendGameCommands();
 
         void receiveConnectionResponsePacket(const ConnectResponsePacket& response);
         void receiveRequestStateResponsePacket(const RequestStateResponse& response);
@@ -69,6 +69,9 @@ namespace OpenLoco::Network
         void receiveChatMessagePacket(const ReceiveChatMessage& packet);
         void receivePingPacket(const PingPacket& packet);
         void receiveGameCommandPacket(const GameCommandPacket& packet);
+        void receiveGameCommandBatchPacket(const GameCommandBatchPacket& packet);
+        void receiveStateHashPacket(const StateHashPacket& packet);
+        void checkStateHashes();
 
     protected:
         void onClose() override;
@@ -1,6 +1,8 @@
 #include "NetworkConnection.h"
 #include "../Console.h"
 #include "../Platform/Platform.h"
+#include <algorithm>
+#include <cstring>
 
 using namespace OpenLoco::Network;
 
@@ -33,8 +35,15 @@ bool NetworkConnection::hasTimedOut() const
     return false;
 }
 
+size_t NetworkConnection::getNumUnacknowledgedPackets()
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    return _sentPackets.size();
+}
+
 void NetworkConnection::update()
 {
+    sendPendingAcknowledgements();
     resendUndeliveredPackets();
 }
 
@@ -64,13 +73,17 @@ void NetworkConnection::receivePacket(const Packet& packet)
     logPacket(packet, false, false);
     if (packet.header.kind == PacketKind::ack)
     {
-        receiveAcknowledgePacket(packet.header.sequence);
+        receiveAcknowledgePacket(packet);
     }
     else
     {
         // Send ACK back, even if we have already received this packet before
-        // the ACK we sent before, may not have been delivered successfully
-        sendAcknowledgePacket(packet.header.sequence);
+        // the ACK we sent before, may not have been delivered successfully.
+        // ACKs are collected and sent together on the next update.
+        {
+            std::unique_lock<std::mutex> lk(_pendingAcknowledgementsSync);
+            _pendingAcknowledgements.push_back(packet.header.sequence);
+        }
 
         // Only store the packet, if this is the first time we received it
         if (!checkOrRecordReceivedSequence(packet.header.sequence))
@@ -108,7 +121,25 @@ void NetworkConnection::sendPacket(const Packet& packet)
     logPacket(packet, true, false);
 }
 
-void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
+// An ACK packet holds the list of acknowledged sequences, or just the sequence in its header
+void NetworkConnection::receiveAcknowledgePacket(const Packet& packet)
+{
+    const auto numSequences = packet.header.dataSize / sizeof(sequence_t);
+    if (numSequences == 0)
+    {
+        receiveAcknowledgement(packet.header.sequence);
+        return;
+    }
+
+    for (size_t i = 0; i < numSequences; i++)
+    {
+        sequence_t sequence;
+        std::memcpy(&sequence, packet.data + i * sizeof(sequence_t), sizeof(sequence_t));
+        receiveAcknowledgement(sequence);
+    }
+}
+
+void NetworkConnection::receiveAcknowledgement(sequence_t sequence)
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
     for (size_t i = 0; i < _sentPackets.size(); i++)
@@ -121,13 +152,26 @@ void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
     }
 }
 
-void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
+void NetworkConnection::sendPendingAcknowledgements()
 {
-    Packet packet;
-    packet.header.kind = PacketKind::ack;
-    packet.header.sequence = sequence;
-    packet.header.dataSize = 0;
-    sendPacket(packet);
+    std::vector<sequence_t> sequences;
+    {
+        std::unique_lock<std::mutex> lk(_pendingAcknowledgementsSync);
+        sequences.swap(_pendingAcknowledgements);
+    }
+
+    constexpr size_t kMaxSequencesPerPacket = kMaxPacketDataSize / sizeof(sequence_t);
+    for (size_t i = 0; i < sequences.size(); i += kMaxSequencesPerPacket)
+    {
+        const auto numSequences = std::min(kMaxSequencesPerPacket, sequences.size() - i);
+
+        Packet packet;
+        packet.header.kind = PacketKind::ack;
+        packet.header.sequence = sequences[i];
+        packet.header.dataSize = static_cast<uint16_t>(numSequences * sizeof(sequence_t));
+        std::memcpy(packet.data, &sequences[i], packet.header.dataSize);
+        sendPacket(packet);
+    }
 }
 
 void NetworkConnection::resendUndeliveredPackets()
@@ -176,6 +220,8 @@ std::optional<Packet> NetworkConnection::takeNextPacket()
         case PacketKind::sendChatMessage: return "SEND CHAT";
         case PacketKind::receiveChatMessage: return "RECEIVE CHAT";
         case PacketKind::gameCommand: return "GAME COMMAND";
+        case PacketKind::stateHash: return "STATE HASH";
+        case PacketKind::gameCommandBatch: return "GAME COMMAND BATCH";
         default: return "UNKNOWN";
     }
 }
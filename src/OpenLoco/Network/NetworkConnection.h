@@ -27,16 +27,19 @@ namespace OpenLoco::Network
         std::unique_ptr<INetworkEndpoint> _endpoint;
         std::mutex _sentPacketsSync;
         std::mutex _receivedPacketsSync;
+        std::mutex _pendingAcknowledgementsSync;
         std::vector<SentPacket> _sentPackets;
         std::queue<Packet> _receivedPackets;
         std::deque<sequence_t> _receivedSequences;
+        std::vector<sequence_t> _pendingAcknowledgements;
         uint16_t _sendSequence{};
         uint32_t _timeOfLastReceivedPacket{};
 
         static uint32_t getTime();
         bool checkOrRecordReceivedSequence(sequence_t sequence);
-        void receiveAcknowledgePacket(sequence_t sequence);
-        void sendAcknowledgePacket(sequence_t sequence);
+        void receiveAcknowledgePacket(const Packet& packet);
+        void receiveAcknowledgement(sequence_t sequence);
+        void sendPendingAcknowledgements();
         void resendUndeliveredPackets();
         void sendPacket(PacketKind kind, size_t dataSize, const void* packetData);
         void logPacket(const Packet& packet, bool sent, bool resend);
@@ -46,6 +49,7 @@ namespace OpenLoco::Network
 
         const INetworkEndpoint& getEndpoint() const;
         bool hasTimedOut() const;
+        size_t getNumUnacknowledgedPackets();
         void update();
         void receivePacket(const Packet& packet);
         void sendPacket(const Packet& packet);
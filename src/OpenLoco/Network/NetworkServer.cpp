@@ -15,6 +15,7 @@ using namespace OpenLoco;
 using namespace OpenLoco::Network;
 
 constexpr uint32_t kPingInterval = 30;
+constexpr size_t kStateTransferWindow = 32;
 
 NetworkServer::~NetworkServer()
 {
@@ -137,6 +138,9 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
         case PacketKind::gameCommand:
             onReceiveGameCommandPacket(client, *packet.cast<GameCommandPacket>());
             break;
+        case PacketKind::gameCommandBatch:
+            onReceiveGameCommandBatchPacket(client, *packet.cast<GameCommandBatchPacket>());
+            break;
         default:
             break;
     }
@@ -144,11 +148,9 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
 
 void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestStatePacket& request)
 {
-    constexpr uint16_t kChunkSize = 4000;
-
     // Dump S5 data to stream
     MemoryStream ms;
-    S5::save(ms, S5::SaveFlags::noWindowClose);
+    S5::save(ms, S5::SaveFlags::noWindowClose | S5::SaveFlags::compress);
 
     // Append extra state
     ExtraState extra;
@@ -156,28 +158,52 @@ void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestSta
     extra.tick = ScenarioManager::getScenarioTicks();
     ms.write(&extra, sizeof(extra));
 
+    constexpr auto kChunkSize = sizeof(RequestStateResponseChunk::data);
+
     RequestStateResponse response;
     response.cookie = request.cookie;
     response.totalSize = ms.getLength();
     response.numChunks = static_cast<uint16_t>((ms.getLength() + (kChunkSize - 1)) / kChunkSize);
     client.connection->sendPacket(response);
 
-    uint32_t offset = 0;
-    uint32_t remaining = response.totalSize;
-    uint16_t index = 0;
-    while (index < response.numChunks)
+    // The chunks are sent over the following updates, see sendStateChunks
+    StateTransfer transfer;
+    transfer.cookie = request.cookie;
+    transfer.data.assign(reinterpret_cast<const uint8_t*>(ms.data()), reinterpret_cast<const uint8_t*>(ms.data()) + ms.getLength());
+    client.stateTransfer = std::move(transfer);
+    sendStateChunks(client);
+}
+
+// Sends the next chunks of a state transfer, limiting the number of packets waiting for acknowledgement
+// so that a large state does not flood the connection.
+void NetworkServer::sendStateChunks(Client& client)
+{
+    if (!client.stateTransfer)
+    {
+        return;
+    }
+
+    auto& transfer = *client.stateTransfer;
+    const auto totalSize = static_cast<uint32_t>(transfer.data.size());
+    while (transfer.offset < totalSize && client.connection->getNumUnacknowledgedPackets() < kStateTransferWindow)
     {
         RequestStateResponseChunk chunk;
-        chunk.cookie = request.cookie;
-        chunk.index = index;
-        chunk.offset = offset;
-        chunk.dataSize = std::min<uint32_t>(kChunkSize, remaining - offset);
-        std::memcpy(chunk.data, reinterpret_cast<const uint8_t*>(ms.data()) + offset, chunk.dataSize);
+        chunk.cookie = transfer.cookie;
+        chunk.totalSize = totalSize;
+        chunk.index = transfer.nextChunk;
+        chunk.offset = transfer.offset;
+        chunk.dataSize = std::min<uint32_t>(sizeof(chunk.data), totalSize - transfer.offset);
+        std::memcpy(chunk.data, transfer.data.data() + transfer.offset, chunk.dataSize);
 
         client.connection->sendPacket(chunk);
 
-        offset += chunk.dataSize;
-        index++;
+        transfer.offset += chunk.dataSize;
+        transfer.nextChunk++;
+    }
+
+    if (transfer.offset >= totalSize)
+    {
+        client.stateTransfer = std::nullopt;
     }
 }
 
@@ -192,6 +218,14 @@ void NetworkServer::onReceiveGameCommandPacket(Client& client, const GameCommand
     queueGameCommand(packet.company, packet.regs);
 }
 
+void NetworkServer::onReceiveGameCommandBatchPacket(Client& client, const GameCommandBatchPacket& packet)
+{
+    for (const auto& command : packet.read())
+    {
+        queueGameCommand(command.company, command.regs);
+    }
+}
+
 void NetworkServer::removedTimedOutClients()
 {
     for (auto it = _clients.begin(); it != _clients.end();)
@@ -296,6 +330,7 @@ void NetworkServer::updateClients()
 {
     for (auto& client : _clients)
     {
+        sendStateChunks(*client);
         client->connection->update();
     }
 }
@@ -306,16 +341,6 @@ void NetworkServer::sendChatMessage(std::string_view message)
     _chatMessageQueue.push({ 0, std::string(message) });
 }
 
-void NetworkServer::sendGameCommand(uint32_t index, uint32_t tick, CompanyId company, const OpenLoco::Interop::registers& regs)
-{
-    GameCommandPacket packet;
-    packet.index = index;
-    packet.tick = tick;
-    packet.company = company;
-    packet.regs = regs;
-    sendPacketToAll(packet);
-}
-
 void NetworkServer::queueGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs)
 {
     GameCommandPacket newPacket;
@@ -331,7 +356,9 @@ void NetworkServer::runGameCommands()
     auto& gameState = getGameState();
     auto tick = gameState.scenarioTicks;
 
-    // Execute all following commands if previously received
+    // Execute all following commands if previously received, they are sent to the clients in as few packets as possible
+    GameCommandBatchPacket batch;
+    batch.tick = tick;
     while (!_gameCommands.empty())
     {
         auto& gc = _gameCommands.front();
@@ -342,9 +369,31 @@ void NetworkServer::runGameCommands()
         //      otherwise we skip a game command index
         // if (result != 0x80000000)
         // {
-        sendGameCommand(gc.index, tick, gc.company, gc.regs);
+        if (!batch.add(gc.company, gc.regs))
+        {
+            sendPacketToAll(batch);
+            batch = {};
+            batch.tick = tick;
+            batch.add(gc.company, gc.regs);
+        }
+        if (batch.count == 1)
+        {
+            batch.firstIndex = gc.index;
+        }
         // }
 
         _gameCommands.pop();
     }
+    if (batch.count != 0)
+    {
+        sendPacketToAll(batch);
+    }
+
+    if (shouldHashState(tick) && !_clients.empty())
+    {
+        StateHashPacket packet;
+        packet.tick = tick;
+        packet.hash = computeStateHash();
+        sendPacketToAll(packet);
+    }
 }
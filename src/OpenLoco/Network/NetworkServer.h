@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../Core/Optional.hpp"
 #include "Network.h"
 #include "NetworkBase.h"
 #include "NetworkConnection.h"
@@ -10,11 +11,20 @@ namespace OpenLoco::Network
 {
     class NetworkConnection;
 
+    struct StateTransfer
+    {
+        uint32_t cookie{};
+        std::vector<uint8_t> data;
+        uint32_t offset{};
+        uint16_t nextChunk{};
+    };
+
     struct Client
     {
         client_id_t id{};
         std::unique_ptr<NetworkConnection> connection;
         std::string name;
+        std::optional<StateTransfer> stateTransfer;
     };
 
     struct ChatMessage
@@ -43,6 +53,8 @@ namespace OpenLoco::Network
         void onReceiveStateRequestPacket(Client& client, const RequestStatePacket& packet);
         void onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet);
         void onReceiveGameCommandPacket(Client& client, const GameCommandPacket& packet);
+        void onReceiveGameCommandBatchPacket(Client& client, const GameCommandBatchPacket& packet);
+        void sendStateChunks(Client& client);
         void removedTimedOutClients();
         void sendPings();
         void sendChatMessages();
@@ -69,7 +81,6 @@ namespace OpenLoco::Network
 
         void listen(const std::string& bind, port_t port);
         void sendChatMessage(std::string_view message) override;
-        void sendGameCommand(uint32_t index, uint32_t tick, CompanyId company, const OpenLoco::Interop::registers& regs);
 
         void queueGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs);
         void runGameCommands();
@@ -2,10 +2,13 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <string_view>
+#include <vector>
 
 #include "../Interop/Interop.hpp"
 #include "Network.h"
+#include "StateHash.h"
 
 namespace OpenLoco::Network
 {
@@ -25,6 +28,8 @@ namespace OpenLoco::Network
         sendChatMessage,
         receiveChatMessage,
         gameCommand,
+        stateHash,
+        gameCommandBatch,
     };
 
     struct PacketHeader
@@ -117,10 +122,11 @@ namespace OpenLoco::Network
         size_t size() const { return reinterpret_cast<size_t>(this->data + dataSize) - reinterpret_cast<size_t>(this); }
 
         uint32_t cookie{};
+        uint32_t totalSize{};
         uint16_t index{};
         uint32_t offset{};
         uint32_t dataSize{};
-        uint8_t data[kMaxPacketDataSize - 14]{};
+        uint8_t data[kMaxPacketDataSize - 18]{};
     };
     static_assert(sizeof(RequestStateResponseChunk) == kMaxPacketDataSize);
 
@@ -174,5 +180,96 @@ namespace OpenLoco::Network
         CompanyId company{};
         OpenLoco::Interop::registers regs;
     };
+
+    /**
+     * Consecutive game commands for the same tick. Each command is stored as its company, a mask of the
+     * registers that are set, followed by the values of those registers. Unset registers are kDefaultRegValue.
+     */
+    struct GameCommandBatchPacket
+    {
+        static constexpr PacketKind kind = PacketKind::gameCommandBatch;
+        static constexpr size_t kNumRegisters = sizeof(OpenLoco::Interop::registers) / sizeof(int32_t);
+        static constexpr size_t kMaxCommandSize = 2 + sizeof(OpenLoco::Interop::registers);
+        size_t size() const { return reinterpret_cast<size_t>(this->data + dataSize) - reinterpret_cast<size_t>(this); }
+
+        uint32_t firstIndex{};
+        uint32_t tick{};
+        uint16_t count{};
+        uint16_t dataSize{};
+        uint8_t data[kMaxPacketDataSize - 12]{};
+
+        // Returns false if the command does not fit, in which case the batch needs to be sent first.
+        bool add(CompanyId company, const OpenLoco::Interop::registers& regs)
+        {
+            if (dataSize + kMaxCommandSize > sizeof(data))
+            {
+                return false;
+            }
+
+            int32_t values[kNumRegisters];
+            std::memcpy(values, &regs, sizeof(values));
+
+            auto* dst = data + dataSize;
+            *dst++ = static_cast<uint8_t>(company);
+            auto* mask = dst++;
+            *mask = 0;
+            for (size_t i = 0; i < kNumRegisters; i++)
+            {
+                if (values[i] != kDefaultRegValue)
+                {
+                    *mask |= 1 << i;
+                    std::memcpy(dst, &values[i], sizeof(int32_t));
+                    dst += sizeof(int32_t);
+                }
+            }
+            dataSize = static_cast<uint16_t>(dst - data);
+            count++;
+            return true;
+        }
+
+        std::vector<GameCommandPacket> read() const
+        {
+            std::vector<GameCommandPacket> commands;
+            size_t offset = 0;
+            for (uint16_t i = 0; i < count; i++)
+            {
+                if (offset + 2 > dataSize)
+                {
+                    break;
+                }
+
+                GameCommandPacket command;
+                command.index = firstIndex + i;
+                command.tick = tick;
+                command.company = static_cast<CompanyId>(data[offset++]);
+                const auto mask = data[offset++];
+
+                int32_t values[kNumRegisters];
+                for (size_t r = 0; r < kNumRegisters; r++)
+                {
+                    values[r] = kDefaultRegValue;
+                    if ((mask & (1 << r)) && offset + sizeof(int32_t) <= dataSize)
+                    {
+                        std::memcpy(&values[r], data + offset, sizeof(int32_t));
+                        offset += sizeof(int32_t);
+                    }
+                }
+                std::memcpy(&command.regs, values, sizeof(values));
+                commands.push_back(command);
+            }
+            return commands;
+        }
+    };
+    static_assert(sizeof(GameCommandBatchPacket) == kMaxPacketDataSize);
+
+    struct StateHashPacket
+    {
+        static constexpr PacketKind kind = PacketKind::stateHash;
+        size_t size() const { return sizeof(StateHashPacket); }
+
+        uint32_t tick{};
+        StateHash hash{};
+    };
+    static_assert(sizeof(StateHashPacket) <= kMaxPacketDataSize);
 #pragma pack(pop)
 }
@@ -0,0 +1,226 @@
+#include "StateHash.h"
+#include "../Console.h"
+#include "../Entities/EntityManager.h"
+#include "../GameState.h"
+#include "../Map/Map.hpp"
+#include "../Map/TileManager.h"
+#include "../Vehicles/Vehicle.h"
+#include <cstring>
+#include <iterator>
+
+namespace OpenLoco::Network
+{
+    static constexpr const char* kSectionNames[] = {
+        "entities",
+        "companies",
+        "stations",
+        "tile rows",
+    };
+    static_assert(std::size(kSectionNames) == kNumStateHashSections);
+
+    static constexpr size_t kSectionSizes[] = {
+        Limits::kMaxEntities,
+        Limits::kMaxCompanies,
+        Limits::kMaxStations,
+        Map::kMapRows,
+    };
+    static_assert(std::size(kSectionSizes) == kNumStateHashSections);
+
+    class Hasher
+    {
+    private:
+        uint64_t _hash = 0xCBF29CE484222325;
+
+        void mix(uint64_t word)
+        {
+            _hash ^= word * 0x87C37B91114253D5;
+            _hash = ((_hash << 27) | (_hash >> 37)) * 5 + 0x52DCE729;
+        }
+
+    public:
+        void add(const void* data, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                mix(word);
+            }
+            if (i < size)
+            {
+                uint64_t tail = 0;
+                std::memcpy(&tail, bytes + i, size - i);
+                mix(tail);
+            }
+        }
+
+        void add(uint32_t value)
+        {
+            mix(value);
+        }
+
+        uint64_t get() const
+        {
+            return _hash;
+        }
+    };
+
+    using SectionHasher = std::array<Hasher, kStateHashBlocks>;
+
+    static size_t getBlock(StateHashSection section, size_t index)
+    {
+        return index * kStateHashBlocks / kSectionSizes[static_cast<size_t>(section)];
+    }
+
+    // Ghost game commands only run locally, so a train placed as a ghost is still unplaced to every
+    // other player. Trains that are not placed are skipped on all sides to keep the hashes equal.
+    static bool isUnplacedVehicle(const Entity& entity)
+    {
+        const auto* vehicle = entity.asBase<Vehicles::VehicleBase>();
+        if (vehicle == nullptr)
+        {
+            return false;
+        }
+
+        const auto* head = EntityManager::get<Vehicles::VehicleHead>(vehicle->getHead());
+        return head == nullptr || !head->isPlaced();
+    }
+
+    // The fields touched when the server saves the game for a joining client (the spatial index and
+    // unused entries) are left out, as the clients that are already connected do not see those changes.
+    static void hashEntities(SectionHasher& hashers)
+    {
+        const auto& entities = getGameState().entities;
+        for (uint32_t i = 0; i < std::size(entities); i++)
+        {
+            const auto& entity = entities[i];
+            if (entity.baseType == EntityBaseType::null || isUnplacedVehicle(entity))
+            {
+                continue;
+            }
+
+            auto& hasher = hashers[getBlock(StateHashSection::entities, i)];
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&entity);
+            hasher.add(i);
+            // Skip nextQuadrantId (0x02) and the sprite bounds (0x16 to 0x1D), which depend on the rotation of
+            // each player's main view
+            hasher.add(bytes, 0x02);
+            hasher.add(bytes + 0x04, 0x16 - 0x04);
+            hasher.add(bytes + 0x1E, sizeof(entity) - 0x1E);
+        }
+    }
+
+    static void hashCompanies(SectionHasher& hashers)
+    {
+        const auto& companies = getGameState().companies;
+        for (uint32_t i = 0; i < std::size(companies); i++)
+        {
+            if (companies[i].empty())
+            {
+                continue;
+            }
+
+            auto& hasher = hashers[getBlock(StateHashSection::companies, i)];
+            hasher.add(i);
+            hasher.add(&companies[i], sizeof(companies[i]));
+        }
+    }
+
+    static void hashStations(SectionHasher& hashers)
+    {
+        const auto& stations = getGameState().stations;
+        for (uint32_t i = 0; i < std::size(stations); i++)
+        {
+            if (stations[i].empty())
+            {
+                continue;
+            }
+
+            // The label frame is rebuilt whenever a player zooms or rotates their main view
+            auto station = stations[i];
+            station.labelFrame = {};
+            for (auto j = station.stationTileSize; j < std::size(station.stationTiles); j++)
+            {
+                station.stationTiles[j] = {};
+            }
+
+            auto& hasher = hashers[getBlock(StateHashSection::stations, i)];
+            hasher.add(i);
+            hasher.add(&station, sizeof(station));
+        }
+    }
+
+    // Tile elements are hashed in map order rather than in the order they are stored in, which changes
+    // whenever the elements are reorganised. Ghost elements only exist for the player placing them, so
+    // they are skipped along with the last element flag that depends on them.
+    static void hashTileElements(SectionHasher& hashers)
+    {
+        for (coord_t y = 0; y < Map::kMapRows; y++)
+        {
+            auto& hasher = hashers[getBlock(StateHashSection::tileElements, y)];
+            for (coord_t x = 0; x < Map::kMapColumns; x++)
+            {
+                const auto tile = Map::TileManager::get(Map::TilePos2(x, y));
+                for (const auto& el : tile)
+                {
+                    if (el.isGhost())
+                    {
+                        continue;
+                    }
+
+                    auto element = el;
+                    element.setLastFlag(false);
+                    hasher.add(&element, sizeof(element));
+                }
+                // Keeps the elements of neighbouring tiles apart
+                hasher.add(static_cast<uint32_t>(x));
+            }
+        }
+    }
+
+    StateHash computeStateHash()
+    {
+        std::array<SectionHasher, kNumStateHashSections> hashers{};
+        hashEntities(hashers[static_cast<size_t>(StateHashSection::entities)]);
+        hashCompanies(hashers[static_cast<size_t>(StateHashSection::companies)]);
+        hashStations(hashers[static_cast<size_t>(StateHashSection::stations)]);
+        hashTileElements(hashers[static_cast<size_t>(StateHashSection::tileElements)]);
+
+        StateHash result{};
+        for (size_t section = 0; section < kNumStateHashSections; section++)
+        {
+            for (size_t block = 0; block < kStateHashBlocks; block++)
+            {
+                result[section][block] = hashers[section][block].get();
+            }
+        }
+        return result;
+    }
+
+    bool compareStateHash(uint32_t tick, const StateHash& local, const StateHash& remote)
+    {
+        for (size_t section = 0; section < kNumStateHashSections; section++)
+        {
+            for (size_t block = 0; block < kStateHashBlocks; block++)
+            {
+                if (local[section][block] != remote[section][block])
+                {
+                    // First index that maps to this block and first index of the next block
+                    const auto sectionSize = kSectionSizes[section];
+                    const auto begin = (block * sectionSize + kStateHashBlocks - 1) / kStateHashBlocks;
+                    const auto end = ((block + 1) * sectionSize + kStateHashBlocks - 1) / kStateHashBlocks;
+                    Console::log(
+                        "Desync detected at tick %u: %s %u to %u differ from the server",
+                        tick,
+                        kSectionNames[section],
+                        static_cast<uint32_t>(begin),
+                        static_cast<uint32_t>(end - 1));
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
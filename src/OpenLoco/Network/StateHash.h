@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenLoco::Network
+{
+    enum class StateHashSection : uint8_t
+    {
+        entities,
+        companies,
+        stations,
+        tileElements,
+        count
+    };
+
+    constexpr size_t kNumStateHashSections = static_cast<size_t>(StateHashSection::count);
+
+    // Each section is split into this many blocks so that a desync can be narrowed down to a range of objects.
+    constexpr size_t kStateHashBlocks = 32;
+
+    // Number of ticks between state hashes.
+    constexpr uint32_t kStateHashInterval = 128;
+
+    using StateHash = std::array<std::array<uint64_t, kStateHashBlocks>, kNumStateHashSections>;
+
+    constexpr bool shouldHashState(uint32_t tick)
+    {
+        return tick % kStateHashInterval == 0;
+    }
+
+    StateHash computeStateHash();
+
+    // Returns true if both hashes are equal, otherwise logs the first section and range of objects that differ.
+    bool compareStateHash(uint32_t tick, const StateHash& local, const StateHash& remote);
+}
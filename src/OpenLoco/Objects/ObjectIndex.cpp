@@ -9,8 +9,17 @@
 #include "../Utility/Numeric.hpp"
 #include "../Utility/Stream.hpp"
 #include "ObjectManager.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <fstream>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -202,20 +211,16 @@ namespace OpenLoco::ObjectManager
         return std::make_pair(entry, newEntrySize);
     }
 
-    // Adds a new object to the index by: 1. creating a partial index, 2. validating, 3. creating a full index entry
-    static void addObjectToIndex(const fs::path filepath, size_t& usedBufferSize)
+    // Location of an entry in _installedObjectList while the index is being created
+    struct PendingIndexEntry
     {
-        ObjectHeader objHeader{};
-        {
-            std::ifstream stream;
-            stream.open(filepath, std::ios::in | std::ios::binary);
-            Utility::readData(stream, objHeader);
-            if (stream.gcount() != sizeof(objHeader))
-            {
-                return;
-            }
-        }
+        size_t offset;
+        size_t size;
+    };
 
+    // Adds a new object to the end of the index by: 1. creating a partial index, 2. validating, 3. creating a full index entry
+    static void addObjectToIndex(const fs::path& filepath, ObjectHeader objHeader, size_t& usedBufferSize, std::vector<PendingIndexEntry>& entries)
+    {
         const auto curObjPos = usedBufferSize;
         const auto partialNewEntry = createPartialNewEntry(&_installedObjectList[usedBufferSize], objHeader, filepath.filename());
         usedBufferSize += partialNewEntry.second;
@@ -232,36 +237,93 @@ namespace OpenLoco::ObjectManager
         }
         _installedObjectCount--;
 
-        // Rewind as it is only a partial object loaded
+        // Rewind as it is only a partial object loaded and replace it with the full entry
         usedBufferSize = curObjPos;
-
-        // Load full entry into temp buffer.
-        // 0x009D1CC8
-        std::byte newEntryBuffer[0x2000] = {};
-        const auto [newEntry, newEntrySize] = createNewEntry(newEntryBuffer, objHeader, filepath.filename());
+        const auto [newEntry, newEntrySize] = createNewEntry(&_installedObjectList[usedBufferSize], objHeader, filepath.filename());
+        entries.push_back(PendingIndexEntry{ usedBufferSize, newEntrySize });
+        usedBufferSize += newEntrySize;
 
         freeScenarioText();
 
+        _installedObjectCount++;
+    }
+
+    // Orders the index by object name. Objects with the same name keep the order they were added in.
+    static void sortIndex(std::vector<PendingIndexEntry>& entries, size_t usedBufferSize)
+    {
         auto* indexPtr = *_installedObjectList;
-        // This ptr will be pointing at where in the object list to install the new entry
-        auto* installPtr = indexPtr;
-        for (uint32_t i = 0; i < _installedObjectCount; i++)
+        auto getName = [indexPtr](const PendingIndexEntry& pending) {
+            auto* ptr = indexPtr + pending.offset;
+            return ObjectIndexEntry::read(&ptr)._name;
+        };
+        std::stable_sort(std::begin(entries), std::end(entries), [&getName](const PendingIndexEntry& lhs, const PendingIndexEntry& rhs) {
+            return strcmp(getName(lhs), getName(rhs)) < 0;
+        });
+
+        std::vector<std::byte> sorted(usedBufferSize);
+        size_t sortedSize = 0;
+        for (const auto& pending : entries)
         {
-            auto entry = ObjectIndexEntry::read(&indexPtr);
-            if (strcmp(newEntry._name, entry._name) < 0)
-            {
-                break;
-            }
-            // If cmp < 0 then we will want to install at the previous indexPtr location
-            installPtr = indexPtr;
+            std::memcpy(&sorted[sortedSize], indexPtr + pending.offset, pending.size);
+            sortedSize += pending.size;
         }
+        std::memcpy(indexPtr, sorted.data(), sortedSize);
+    }
 
-        auto moveSize = usedBufferSize - (installPtr - *_installedObjectList);
-        std::memmove(installPtr + newEntrySize, installPtr, moveSize);
-        std::memcpy(installPtr, newEntryBuffer, newEntrySize);
-        usedBufferSize += newEntrySize;
+    struct ObjectFile
+    {
+        fs::path path;
+        std::optional<ObjectHeader> header;
+    };
 
-        _installedObjectCount++;
+    static std::optional<ObjectHeader> readObjectFileHeader(const fs::path& filepath)
+    {
+        std::ifstream stream;
+        stream.open(filepath, std::ios::in | std::ios::binary);
+        ObjectHeader objHeader{};
+        Utility::readData(stream, objHeader);
+        if (stream.gcount() != sizeof(objHeader))
+        {
+            return std::nullopt;
+        }
+
+        // Read through the rest of the file so that the partial load that follows on the
+        // main thread does not have to wait for the disk.
+        char buffer[0x10000];
+        while (stream.read(buffer, sizeof(buffer)))
+        {
+        }
+        return objHeader;
+    }
+
+    // Reads the headers of all object files using a pool of worker threads
+    static void readObjectFileHeaders(std::vector<ObjectFile>& files)
+    {
+        std::atomic<size_t> nextFile{ 0 };
+        std::atomic<size_t> numRead{ 0 };
+        auto worker = [&files, &nextFile, &numRead]() {
+            for (auto i = nextFile++; i < files.size(); i = nextFile++)
+            {
+                files[i].header = readObjectFileHeader(files[i].path);
+                numRead++;
+            }
+        };
+
+        const auto numThreads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), files.size());
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            threads.emplace_back(worker);
+        }
+        while (numRead < files.size())
+        {
+            Ui::processMessagesMini();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
     }
 
     // 0x0047118B
@@ -289,10 +351,8 @@ namespace OpenLoco::ObjectManager
         }
 
         _installedObjectCount = 0;
-        // Create new index by iterating all DAT files and processing
-        IndexHeader header{};
-        uint8_t progress = 0;      // Progress is used for the ProgressBar Ui element
-        size_t usedBufferSize = 0; // Keep track of used space to allow for growth and for final sizing
+
+        std::vector<ObjectFile> files;
         const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
         for (const auto& file : fs::directory_iterator(objectPath, fs::directory_options::skip_permission_denied))
         {
@@ -305,6 +365,18 @@ namespace OpenLoco::ObjectManager
             {
                 continue;
             }
+            files.push_back(ObjectFile{ file.path(), std::nullopt });
+        }
+        readObjectFileHeaders(files);
+
+        // Create new index by processing all DAT files, entries are sorted once all have been added
+        IndexHeader header{};
+        uint8_t progress = 0;      // Progress is used for the ProgressBar Ui element
+        size_t usedBufferSize = 0; // Keep track of used space to allow for growth and for final sizing
+        std::vector<PendingIndexEntry> entries;
+        entries.reserve(files.size());
+        for (const auto& file : files)
+        {
             Ui::processMessagesMini();
             header.state.numObjects++;
 
@@ -316,6 +388,11 @@ namespace OpenLoco::ObjectManager
                 Ui::ProgressBar::setProgress(newProgress);
             }
 
+            if (!file.header.has_value())
+            {
+                continue;
+            }
+
             // Grow object list buffer if near limit
             const auto remainingBuffer = bufferSize - usedBufferSize;
             if (remainingBuffer < 0x231E)
@@ -330,8 +407,9 @@ namespace OpenLoco::ObjectManager
                 }
             }
 
-            addObjectToIndex(file.path(), usedBufferSize);
+            addObjectToIndex(file.path, *file.header, usedBufferSize, entries);
         }
+        sortIndex(entries, usedBufferSize);
 
         // New index creation completed. Reset and save result.
         reloadAll();
@@ -386,6 +464,52 @@ namespace OpenLoco::ObjectManager
         return true;
     }
 
+    // Only the parts of the header that ObjectHeader::operator== compares for every object are hashed
+    struct ObjectHeaderNameHash
+    {
+        size_t operator()(const ObjectHeader& header) const
+        {
+            return std::hash<std::string_view>{}(header.getName()) * 31 + enumValue(header.getType());
+        }
+    };
+
+    struct ObjectHeaderNameEqual
+    {
+        bool operator()(const ObjectHeader& lhs, const ObjectHeader& rhs) const
+        {
+            return lhs.getType() == rhs.getType() && lhs.getName() == rhs.getName();
+        }
+    };
+
+    // Lookup tables for _installedObjectList, rebuilt whenever the index is loaded
+    static std::array<std::vector<std::pair<uint32_t, ObjectIndexEntry>>, maxObjectTypes> _availableObjects;
+    static std::unordered_multimap<ObjectHeader, uint32_t, ObjectHeaderNameHash, ObjectHeaderNameEqual> _installedObjectLookup;
+    static std::vector<ObjectIndexEntry> _installedObjectEntries;
+
+    static void buildIndexLookup()
+    {
+        for (auto& objects : _availableObjects)
+        {
+            objects.clear();
+        }
+        _installedObjectLookup.clear();
+        _installedObjectEntries.clear();
+
+        auto* ptr = *_installedObjectList;
+        for (uint32_t i = 0; i < _installedObjectCount; i++)
+        {
+            auto entry = ObjectIndexEntry::read(&ptr);
+            _installedObjectEntries.push_back(entry);
+            _installedObjectLookup.emplace(*entry._header, i);
+
+            const auto type = enumValue(entry._header->getType());
+            if (type < maxObjectTypes)
+            {
+                _availableObjects[type].emplace_back(i, entry);
+            }
+        }
+    }
+
     // 0x00470F3C
     void loadIndex()
     {
@@ -397,6 +521,7 @@ namespace OpenLoco::ObjectManager
             createIndex(currentState);
         }
 
+        buildIndexLookup();
         _customObjectsInIndex = hasCustomObjectsInIndex();
     }
 
@@ -405,34 +530,38 @@ namespace OpenLoco::ObjectManager
         return *_installedObjectCount;
     }
 
-    std::vector<std::pair<uint32_t, ObjectIndexEntry>> getAvailableObjects(ObjectType type)
+    const std::vector<std::pair<uint32_t, ObjectIndexEntry>>& getAvailableObjects(ObjectType type)
     {
-        auto ptr = (std::byte*)_installedObjectList;
-        std::vector<std::pair<uint32_t, ObjectIndexEntry>> list;
+        static const std::vector<std::pair<uint32_t, ObjectIndexEntry>> kNoObjects;
+        const auto typeIndex = enumValue(type);
+        return typeIndex < maxObjectTypes ? _availableObjects[typeIndex] : kNoObjects;
+    }
 
-        for (uint32_t i = 0; i < _installedObjectCount; i++)
+    // Returns the index of the first installed object matching the header
+    std::optional<uint32_t> findInstalledObject(const ObjectHeader& objectHeader)
+    {
+        std::optional<uint32_t> result;
+        const auto [begin, end] = _installedObjectLookup.equal_range(objectHeader);
+        for (auto it = begin; it != end; ++it)
         {
-            auto entry = ObjectIndexEntry::read(&ptr);
-            if (entry._header->getType() == type)
-                list.emplace_back(std::pair<uint32_t, ObjectIndexEntry>(i, entry));
+            // Comparison is done in the same direction as a search through the installed objects would
+            if (it->first == objectHeader && (!result.has_value() || it->second < *result))
+            {
+                result = it->second;
+            }
         }
-
-        return list;
+        return result;
     }
 
     bool isObjectInstalled(const ObjectHeader& objectHeader)
     {
-        const auto objects = getAvailableObjects(objectHeader.getType());
-        auto res = std::find_if(std::begin(objects), std::end(objects), [&objectHeader](auto& obj) { return *obj.second._header == objectHeader; });
-        return res != std::end(objects);
+        return findInstalledObject(objectHeader).has_value();
     }
 
     // 0x00472AFE
     ObjIndexPair getActiveObject(ObjectType objectType, uint8_t* edi)
     {
-        const auto objects = getAvailableObjects(objectType);
-
-        for (auto [index, object] : objects)
+        for (const auto& [index, object] : getAvailableObjects(objectType))
         {
             if (edi[index] & (1 << 0))
             {
@@ -443,6 +572,11 @@ namespace OpenLoco::ObjectManager
         return { -1, ObjectIndexEntry{} };
     }
 
+    ObjectIndexEntry getInstalledObject(uint32_t index)
+    {
+        return _installedObjectEntries[index];
+    }
+
     ObjectIndexEntry ObjectIndexEntry::read(std::byte** ptr)
     {
         ObjectIndexEntry entry{};
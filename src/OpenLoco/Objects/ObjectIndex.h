@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../Core/Optional.hpp"
 #include "../Core/Span.hpp"
 #include "Object.h"
 #include <vector>
@@ -25,7 +26,9 @@ namespace OpenLoco::ObjectManager
 
     void loadIndex();
 
-    std::vector<std::pair<uint32_t, ObjectIndexEntry>> getAvailableObjects(ObjectType type);
+    const std::vector<std::pair<uint32_t, ObjectIndexEntry>>& getAvailableObjects(ObjectType type);
+    std::optional<uint32_t> findInstalledObject(const ObjectHeader& objectHeader);
+    ObjectIndexEntry getInstalledObject(uint32_t index);
     bool isObjectInstalled(const ObjectHeader& objectHeader);
     ObjIndexPair getActiveObject(ObjectType objectType, uint8_t* edi);
 }
@@ -47,6 +47,9 @@
 #include "VehicleObject.h"
 #include "WallObject.h"
 #include "WaterObject.h"
+#include <string>
+#include <system_error>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenLoco::Interop;
@@ -535,21 +538,32 @@ namespace OpenLoco::ObjectManager
         return checksum == object.checksum;
     }
 
-    // 0x00471BC5
-    static bool load(const ObjectHeader& header, LoadedObjectId id)
+    // Decoded and checksum verified object file data, kept so that loading the same objects again
+    // (e.g. when switching scenarios) does not have to read and decode the files again.
+    struct CachedObjectData
+    {
+        ObjectHeader header;
+        fs::file_time_type lastWriteTime;
+        std::vector<uint8_t> data;
+    };
+
+    static constexpr size_t kMaxObjectDataCacheSize = 128 * 1024 * 1024;
+    static std::unordered_map<std::string, CachedObjectData> _objectDataCache;
+    static size_t _objectDataCacheSize = 0;
+
+    // Returns the decoded data of an installed object file, or nullptr if it does not match the header.
+    static const CachedObjectData* readObjectData(const ObjectHeader& header, const char* filename)
     {
-        // somewhat duplicates isObjectInstalled
-        const auto installedObjects = getAvailableObjects(header.getType());
-        auto res = std::find_if(std::begin(installedObjects), std::end(installedObjects), [&header](auto& obj) { return *obj.second._header == header; });
-        if (res == std::end(installedObjects))
+        const auto filePath = Environment::getPath(Environment::PathId::objects) / fs::u8path(filename);
+
+        std::error_code ec;
+        const auto lastWriteTime = fs::last_write_time(filePath, ec);
+        auto cached = _objectDataCache.find(filename);
+        if (!ec && cached != _objectDataCache.end() && cached->second.header == header && cached->second.lastWriteTime == lastWriteTime)
         {
-            // Object is not installed
-            return false;
+            return &cached->second;
         }
 
-        const auto& installedObject = res->second;
-        const auto filePath = Environment::getPath(Environment::PathId::objects) / fs::u8path(installedObject._filename);
-
         SawyerStreamReader stream(filePath);
         ObjectHeader loadingHeader;
         stream.read(&loadingHeader, sizeof(loadingHeader));
@@ -557,7 +571,7 @@ namespace OpenLoco::ObjectManager
         {
             // Something wrong has happened and installed object does not match index
             // Vanilla continued to search for subsequent matching installed headers.
-            return false;
+            return nullptr;
         }
 
         // Vanilla would branch and perform more efficient readChunk if size was known from installedObject.ObjectHeader2
@@ -566,8 +580,45 @@ namespace OpenLoco::ObjectManager
         if (!computeObjectChecksum(loadingHeader, data))
         {
             // Something wrong has happened and installed object checksum is broken
+            return nullptr;
+        }
+
+        if (cached != _objectDataCache.end())
+        {
+            _objectDataCacheSize -= cached->second.data.size();
+            _objectDataCache.erase(cached);
+        }
+        if (_objectDataCacheSize + data.size() > kMaxObjectDataCacheSize)
+        {
+            _objectDataCache.clear();
+            _objectDataCacheSize = 0;
+        }
+
+        auto& entry = _objectDataCache[filename];
+        entry.header = loadingHeader;
+        entry.lastWriteTime = ec ? fs::file_time_type{} : lastWriteTime;
+        entry.data.assign(std::begin(data), std::end(data));
+        _objectDataCacheSize += entry.data.size();
+        return &entry;
+    }
+
+    // 0x00471BC5
+    static bool load(const ObjectHeader& header, LoadedObjectId id)
+    {
+        const auto installedIndex = findInstalledObject(header);
+        if (!installedIndex.has_value())
+        {
+            // Object is not installed
+            return false;
+        }
+
+        const auto* objectData = readObjectData(header, getInstalledObject(*installedIndex)._filename);
+        if (objectData == nullptr)
+        {
             return false;
         }
+        const auto& loadingHeader = objectData->header;
+        const auto& data = objectData->data;
 
         // Copy the object into Loco freeable memory (required for when load loads the object)
         auto* object = reinterpret_cast<Object*>(malloc(data.size()));
@@ -5,6 +5,7 @@
 #include <cstring>
 #include <iostream>
 #include <setjmp.h>
+#include <stdexcept>
 #include <string>
 #include <thread>
 #include <vector>
@@ -56,6 +57,7 @@
 #include "OpenLoco.h"
 #include "Platform/Crash.h"
 #include "Platform/Platform.h"
+#include "Profiler.h"
 #include "S5/S5.h"
 #include "Scenario.h"
 #include "ScenarioManager.h"
@@ -101,8 +103,10 @@ namespace OpenLoco
     static loco_global<char[256], 0x011368A0> _11368A0;
 
     static int32_t _monthsSinceLastAutosave;
+    static std::thread _autosaveThread;
 
     static void autosaveReset();
+    static void autosaveWait();
     static void tickLogic(int32_t count);
     static void tickLogic();
     static void dateTick();
@@ -206,6 +210,7 @@ namespace OpenLoco
     // 0x004BE65E
     [[noreturn]] void exitCleanly()
     {
+        autosaveWait();
         Audio::disposeDSound();
         Audio::close();
         Ui::disposeCursors();
@@ -219,6 +224,12 @@ namespace OpenLoco
             printf("Removing temp file '%s'\n", path8.c_str());
             fs::remove(tempFilePath);
         }
+        const auto& tracePath = getCommandLineOptions().tracePath;
+        if (!tracePath.empty() && !Profiler::exportChromeTrace(fs::u8path(tracePath)))
+        {
+            Console::error("Unable to write trace to %s", tracePath.c_str());
+        }
+
         crashClose(_exHandler);
 
         // SDL_Quit();
@@ -765,26 +776,55 @@ namespace OpenLoco
         if (!Network::shouldProcessTick(ScenarioManager::getScenarioTicks() + 1))
             return;
 
+        Profiler::beginTick();
         ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
         ScenarioManager::setScenarioTicks2(ScenarioManager::getScenarioTicks2() + 1);
         Network::processGameCommands(ScenarioManager::getScenarioTicks());
 
         addr<0x00525FCC, uint32_t>() = gPrng().srand_0();
         addr<0x00525FD0, uint32_t>() = gPrng().srand_1();
-        call(0x004613F0); // Map::TileManager::reorg?
+        Map::TileManager::compactElements();
         addr<0x00F25374, uint8_t>() = S5::getOptions().madeAnyChanges;
         dateTick();
-        Map::TileManager::update();
-        Map::WaveManager::update();
-        TownManager::update();
-        IndustryManager::update();
-        EntityManager::updateVehicles();
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::tileManager);
+            Map::TileManager::update();
+        }
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::waveManager);
+            Map::WaveManager::update();
+        }
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::townManager);
+            TownManager::update();
+        }
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::industryManager);
+            IndustryManager::update();
+        }
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::vehicles);
+            EntityManager::updateVehicles();
+        }
         sub_46FFCA();
-        StationManager::update();
-        EntityManager::updateMiscEntities();
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::stationManager);
+            StationManager::update();
+        }
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::miscEntities);
+            EntityManager::updateMiscEntities();
+        }
         sub_46FFCA();
-        CompanyManager::update();
-        Map::AnimationManager::update();
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::companyManager);
+            CompanyManager::update();
+        }
+        {
+            Profiler::ScopedZone zone(Profiler::Zone::animationManager);
+            Map::AnimationManager::update();
+        }
+        StationManager::updateAcceptance();
         Audio::updateVehicleNoise();
         Audio::updateAmbientNoise();
         Title::update();
@@ -802,6 +842,7 @@ namespace OpenLoco
             _50C197 = 0;
             Ui::Windows::showError(title, message);
         }
+        Profiler::endTick();
     }
 
     static void autosaveReset()
@@ -809,7 +850,7 @@ namespace OpenLoco
         _monthsSinceLastAutosave = 0;
     }
 
-    static void autosaveClean()
+    static void autosaveClean(size_t amountToKeep)
     {
         try
         {
@@ -832,7 +873,6 @@ namespace OpenLoco
                     }
                 }
 
-                auto amountToKeep = static_cast<size_t>(std::max(1, Config::getNew().autosaveAmount));
                 if (autosaveFiles.size() > amountToKeep)
                 {
                     // Sort them by name (which should correspond to date order)
@@ -855,8 +895,20 @@ namespace OpenLoco
         }
     }
 
+    // Waits for the previous autosave to finish writing.
+    static void autosaveWait()
+    {
+        if (_autosaveThread.joinable())
+        {
+            _autosaveThread.join();
+        }
+    }
+
+    // The game state is copied on the game thread, encoding and writing it is done on a worker thread.
     static void autosave()
     {
+        autosaveWait();
+
         // Format filename
         auto time = std::time(nullptr);
         auto localTime = std::localtime(&time);
@@ -882,7 +934,14 @@ namespace OpenLoco
 
             auto autosaveFullPath8 = autosaveFullPath.u8string();
             std::printf("Autosaving game to %s\n", autosaveFullPath8.c_str());
-            S5::save(autosaveFullPath, S5::SaveFlags::noWindowClose);
+            auto snapshot = S5::createSnapshot(S5::SaveFlags::noWindowClose);
+            auto amountToKeep = static_cast<size_t>(std::max(1, Config::getNew().autosaveAmount));
+            _autosaveThread = std::thread([snapshot = std::move(snapshot), autosaveFullPath, amountToKeep] {
+                if (S5::saveSnapshot(autosaveFullPath, *snapshot))
+                {
+                    autosaveClean(amountToKeep);
+                }
+            });
         }
         catch (const std::exception& e)
         {
@@ -900,7 +959,6 @@ namespace OpenLoco
             if (freq > 0 && _monthsSinceLastAutosave >= freq)
             {
                 autosave();
-                autosaveClean();
             }
         }
     }
@@ -1103,36 +1161,74 @@ namespace OpenLoco
         _glpCmdLine = "";
     }
 
-    void simulateGame(const fs::path& path, int32_t ticks)
+    static bool _headlessInitialised = false;
+
+    // Loads a saved game or scenario without a window, initialising the game the first time it is called.
+    static bool loadGameHeadless(const fs::path& path)
     {
-        Config::readNewConfig();
-        Environment::resolvePaths();
-        resetCmdline();
-        registerHooks();
+        if (!_headlessInitialised)
+        {
+            Config::readNewConfig();
+            Environment::resolvePaths();
+            resetCmdline();
+            registerHooks();
+        }
 
         try
         {
-            initialise();
+            if (!_headlessInitialised)
+            {
+                initialise();
+                _headlessInitialised = true;
+            }
             loadFile(path);
         }
         catch (const std::exception& e)
         {
             Console::error("Unable to simulate park: %s", e.what());
+            return false;
         }
         catch (const GameException i)
         {
             if (i != GameException::Interrupt)
             {
                 Console::error("Unable to simulate park!");
+                return false;
             }
             else
             {
                 Console::log("File loaded. Starting simulation.");
             }
         }
+        return true;
+    }
+
+    void simulateGame(const fs::path& path, int32_t ticks)
+    {
+        loadGameHeadless(path);
         tickLogic(ticks);
     }
 
+    std::vector<Profiler::TickTimings> benchmarkGame(const fs::path& path, int32_t ticks)
+    {
+        if (!loadGameHeadless(path))
+        {
+            throw std::runtime_error("Unable to load " + path.u8string());
+        }
+
+        std::vector<Profiler::TickTimings> timings;
+        timings.reserve(std::max(ticks, 0));
+
+        Profiler::setEnabled(true);
+        for (int32_t i = 0; i < ticks; i++)
+        {
+            tickLogic();
+            timings.push_back(Profiler::getLastTick());
+        }
+        Profiler::setEnabled(false);
+        return timings;
+    }
+
     // 0x00406D13
     static int main(const CommandLineOptions& options)
     {
@@ -1159,6 +1255,7 @@ namespace OpenLoco
         {
             const auto& cfg = Config::readNewConfig();
             Environment::resolvePaths();
+            Profiler::setEnabled(cfg.showProfiler || !options.tracePath.empty());
 
             resetCmdline();
             registerHooks();
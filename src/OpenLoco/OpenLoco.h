@@ -1,10 +1,12 @@
 #pragma once
 
 #include "Core/FileSystem.hpp"
+#include "Profiler.h"
 #include "Utility/Prng.hpp"
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace OpenLoco
 {
@@ -25,6 +27,7 @@ namespace OpenLoco
     Utility::prng& gPrng();
     void initialiseViewports();
     void simulateGame(const fs::path& path, int32_t ticks);
+    std::vector<Profiler::TickTimings> benchmarkGame(const fs::path& path, int32_t ticks);
 
     void sub_431695(uint16_t var_F253A0);
     int main(int argc, const char** argv);
@@ -6,13 +6,19 @@
 #include "../Localisation/FormatArguments.hpp"
 #include "../Map/Tile.h"
 #include "../Map/TileManager.h"
+#include "../Profiler.h"
 #include "../StationManager.h"
 #include "../TownManager.h"
 #include "../Ui.h"
 #include "../Ui/WindowManager.h"
+#include "../Viewport.hpp"
 #include "PaintEntity.h"
 #include "PaintTile.h"
 #include "PaintTrack.h"
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui::ViewportInteraction;
@@ -21,6 +27,21 @@ namespace OpenLoco::Paint
 {
     PaintSession _session;
 
+    // The paint entries are allocated from chunks, the first one being the fixed vanilla array. Additional
+    // chunks are allocated when a session runs out of space and are kept for later sessions.
+    constexpr size_t kPaintEntriesPerChunk = 4000;
+
+    // Entries left at the end of each chunk, arrangeStructs allocates its head without checking the end
+    constexpr size_t kPaintEntriesChunkMargin = 2;
+
+    // Free entries ensured before painting a tile so the vanilla paint functions, which cannot move on to
+    // the next chunk, do not run out of space.
+    constexpr size_t kPaintEntriesPerTileReserve = 256;
+
+    static std::vector<std::unique_ptr<uint8_t[]>> _paintChunks;
+    static PaintArenaStats _arenaStats;
+    static PaintArenaStats _lastArenaStats;
+
     void PaintSession::setEntityPosition(const Map::Pos2& pos)
     {
         _spritePositionX = pos.x;
@@ -319,11 +340,82 @@ namespace OpenLoco::Paint
         return attached;
     }
 
+    static PaintEntry* getPaintChunkEntries(const size_t index)
+    {
+        return reinterpret_cast<PaintEntry*>(_paintChunks[index].get());
+    }
+
+    // Returns the index of the chunk the session is currently allocating from, 0 being the vanilla array
+    static size_t getCurrentPaintChunk(const PaintEntry* endOfChunk)
+    {
+        for (size_t i = 0; i < _paintChunks.size(); i++)
+        {
+            if (endOfChunk == &getPaintChunkEntries(i)[kPaintEntriesPerChunk - kPaintEntriesChunkMargin])
+            {
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    // Moves the session on to the next chunk, allocating it if needed
+    PaintEntry* PaintSession::allocatePaintChunk()
+    {
+        const auto nextChunk = getCurrentPaintChunk(*_endOfPaintStructArray);
+        if (nextChunk >= _paintChunks.size())
+        {
+            _paintChunks.push_back(std::make_unique<uint8_t[]>(kPaintEntriesPerChunk * sizeof(PaintEntry)));
+            _arenaStats.numChunks = static_cast<uint32_t>(_paintChunks.size() + 1);
+        }
+
+        auto* chunk = getPaintChunkEntries(nextChunk);
+        _nextFreePaintStruct = chunk;
+        _endOfPaintStructArray = &chunk[kPaintEntriesPerChunk - kPaintEntriesChunkMargin];
+        return chunk;
+    }
+
+    void PaintSession::reservePaintEntries(const size_t count)
+    {
+        const auto available = reinterpret_cast<uintptr_t>(*_endOfPaintStructArray) - reinterpret_cast<uintptr_t>(*_nextFreePaintStruct);
+        if (*_nextFreePaintStruct >= *_endOfPaintStructArray || available < count * sizeof(PaintEntry))
+        {
+            allocatePaintChunk();
+        }
+    }
+
+    // Number of entries used by the session so far, counting earlier chunks as full
+    uint32_t PaintSession::getNumPaintEntries()
+    {
+        const auto chunk = getCurrentPaintChunk(*_endOfPaintStructArray);
+        const auto* chunkStart = chunk == 0 ? &_paintEntries[0] : getPaintChunkEntries(chunk - 1);
+        const auto used = (reinterpret_cast<uintptr_t>(*_nextFreePaintStruct) - reinterpret_cast<uintptr_t>(chunkStart)) / sizeof(PaintEntry);
+        return static_cast<uint32_t>(chunk * (kPaintEntriesPerChunk - kPaintEntriesChunkMargin) + used);
+    }
+
+    const PaintArenaStats& getArenaStats()
+    {
+        return _lastArenaStats;
+    }
+
+    void endFrame()
+    {
+        _lastArenaStats = _arenaStats;
+        _arenaStats = {};
+        _arenaStats.numChunks = static_cast<uint32_t>(_paintChunks.size() + 1);
+    }
+
     void PaintSession::init(Gfx::RenderTarget& rt, const uint16_t viewportFlags)
     {
-        _renderTarget = &rt;
         _nextFreePaintStruct = &_paintEntries[0];
-        _endOfPaintStructArray = &_paintEntries[3998];
+        _endOfPaintStructArray = &_paintEntries[kPaintEntriesPerChunk - kPaintEntriesChunkMargin];
+        initContinued(rt, viewportFlags);
+    }
+
+    void PaintSession::initContinued(Gfx::RenderTarget& rt, const uint16_t viewportFlags)
+    {
+        _renderTarget = &rt;
+        renderTarget = &rt;
+        firstPaintEntry = getNumPaintEntries();
         _lastPS = nullptr;
         for (auto& quadrant : _quadrants)
         {
@@ -338,6 +430,14 @@ namespace OpenLoco::Paint
         viewFlags = viewportFlags;
     }
 
+    void PaintSession::makeCurrent()
+    {
+        _renderTarget = renderTarget;
+        _paintHead = paintHead;
+        _paintStringHead = paintStringHead;
+        addr<0x00E3F0BC, uint16_t>() = viewFlags; // Remove when all users of 0x00E3F0BC implemented
+    }
+
     // 0x0045A6CA
     PaintSession* allocateSession(Gfx::RenderTarget& rt, uint16_t viewportFlags)
     {
@@ -434,25 +534,35 @@ namespace OpenLoco::Paint
     {
         for (; p.numVerticalQuadrants > 0; --p.numVerticalQuadrants)
         {
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintTileElements(*this, p.mapLoc);
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintEntities(*this, p.mapLoc);
 
             auto loc1 = p.mapLoc + p.additionalQuadrants[0];
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintTileElements2(*this, loc1);
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintEntities(*this, loc1);
 
             auto loc2 = p.mapLoc + p.additionalQuadrants[1];
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintTileElements(*this, loc2);
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintEntities(*this, loc2);
 
             auto loc3 = p.mapLoc + p.additionalQuadrants[2];
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintTileElements2(*this, loc3);
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintEntities(*this, loc3);
 
             auto loc4 = p.mapLoc + p.additionalQuadrants[3];
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintEntities2(*this, loc4);
 
             auto loc5 = p.mapLoc + p.additionalQuadrants[4];
+            reservePaintEntries(kPaintEntriesPerTileReserve);
             paintEntities2(*this, loc5);
 
             p.mapLoc += p.nextVerticalQuadrant;
@@ -526,6 +636,7 @@ namespace OpenLoco::Paint
         if (!Game::hasFlags(1u << 0))
             return;
 
+        Profiler::ScopedZone zone(Profiler::Zone::paintGenerate);
         viewFlags = addr<0x00E3F0BC, uint16_t>();
         currentRotation = Ui::WindowManager::getCurrentRotation();
         switch (currentRotation)
@@ -595,173 +706,363 @@ namespace OpenLoco::Paint
         return false;
     }
 
+    // Moves the entry at position from to position to (to < from), shifting the entries in between.
+    static void moveSortEntry(std::vector<SortEntry>& entries, size_t from, size_t to)
+    {
+        std::rotate(entries.begin() + to, entries.begin() + from, entries.begin() + from + 1);
+    }
+
+    // Array version of the vanilla linked list sort. Positions are offset by one so that 0 refers to the
+    // paint head which precedes the first entry. Performs exactly the same moves as the list version so the
+    // resulting draw order is identical.
     template<uint8_t _TRotation>
-    static PaintStruct* arrangeStructsHelperRotation(PaintStruct* psNext, const uint16_t quadrantIndex, const uint8_t flag)
+    static size_t arrangeStructsHelperRotation(std::vector<SortEntry>& entries, size_t entryPos, const uint16_t quadrantIndex, const uint8_t flag)
     {
-        PaintStruct* ps = nullptr;
+        const size_t numEntries = entries.size();
+        auto at = [&entries](size_t pos) -> SortEntry& { return entries[pos - 1]; };
 
         // Get the first node in the specified quadrant.
-        do
+        size_t pos = entryPos;
+        while (true)
         {
-            ps = psNext;
-            psNext = psNext->nextQuadrantPS;
-            if (psNext == nullptr)
-                return ps;
-        } while (quadrantIndex > psNext->quadrantIndex);
+            if (pos + 1 > numEntries)
+                return pos;
+            if (!(quadrantIndex > at(pos + 1).quadrantIndex))
+                break;
+            pos++;
+        }
 
         // We keep track of the first node in the quadrant so the next call with a higher quadrant index
         // can use this node to skip some iterations.
-        auto* psQuadrantEntry = ps;
+        const size_t quadrantEntryPos = pos;
 
         // Visit all nodes in the linked quadrant list and determine their current
         // sorting relevancy.
-        auto* psTemp = ps;
-        do
+        for (size_t i = pos + 1; i <= numEntries; i++)
         {
-            ps = ps->nextQuadrantPS;
-            if (ps == nullptr)
-                break;
-
-            if (ps->quadrantIndex > quadrantIndex + 1)
+            auto& entry = at(i);
+            if (entry.quadrantIndex > quadrantIndex + 1)
             {
                 // Outside of the range.
-                ps->quadrantFlags = QuadrantFlags::outsideQuadrant;
+                entry.quadrantFlags = QuadrantFlags::outsideQuadrant;
+                break;
             }
-            else if (ps->quadrantIndex == quadrantIndex + 1)
+            else if (entry.quadrantIndex == quadrantIndex + 1)
             {
                 // Is neighbour and requires a visit.
-                ps->quadrantFlags = QuadrantFlags::neighbour | QuadrantFlags::pendingVisit;
+                entry.quadrantFlags = QuadrantFlags::neighbour | QuadrantFlags::pendingVisit;
             }
-            else if (ps->quadrantIndex == quadrantIndex)
+            else if (entry.quadrantIndex == quadrantIndex)
             {
                 // In specified quadrant, requires visit.
-                ps->quadrantFlags = flag | QuadrantFlags::pendingVisit;
+                entry.quadrantFlags = flag | QuadrantFlags::pendingVisit;
             }
-        } while (ps->quadrantIndex <= quadrantIndex + 1);
-        ps = psTemp;
+        }
 
         // Iterate all nodes in the current list and re-order them based on
         // the current rotation and their bounding box.
         while (true)
         {
             // Get the first pending node in the quadrant list
+            size_t current;
             while (true)
             {
-                psNext = ps->nextQuadrantPS;
-                if (psNext == nullptr)
+                current = pos + 1;
+                if (current > numEntries)
                 {
                     // End of the current list.
-                    return psQuadrantEntry;
+                    return quadrantEntryPos;
                 }
-                if (psNext->quadrantFlags & QuadrantFlags::outsideQuadrant)
+                if (at(current).quadrantFlags & QuadrantFlags::outsideQuadrant)
                 {
                     // Reached point outside of specified quadrant.
-                    return psQuadrantEntry;
+                    return quadrantEntryPos;
                 }
-                if (psNext->quadrantFlags & QuadrantFlags::pendingVisit)
+                if (at(current).quadrantFlags & QuadrantFlags::pendingVisit)
                 {
                     // Found node to check on.
                     break;
                 }
-                ps = psNext;
+                pos = current;
             }
 
             // Mark visited.
-            psNext->quadrantFlags &= ~QuadrantFlags::pendingVisit;
-            psTemp = ps;
+            at(current).quadrantFlags &= ~QuadrantFlags::pendingVisit;
 
             // Compare current node against the remaining children.
-            const PaintStructBoundBox& initialBBox = psNext->bounds;
-            while (true)
+            const PaintStructBoundBox initialBBox = at(current).bounds;
+            for (size_t next = current + 1; next <= numEntries; next++)
             {
-                ps = psNext;
-                psNext = psNext->nextQuadrantPS;
-                if (psNext == nullptr)
-                    break;
-                if (psNext->quadrantFlags & QuadrantFlags::outsideQuadrant)
+                const auto& nextEntry = at(next);
+                if (nextEntry.quadrantFlags & QuadrantFlags::outsideQuadrant)
                     break;
-                if (!(psNext->quadrantFlags & QuadrantFlags::neighbour))
+                if (!(nextEntry.quadrantFlags & QuadrantFlags::neighbour))
                     continue;
 
-                const PaintStructBoundBox& currentBBox = psNext->bounds;
-
-                const bool compareResult = checkBoundingBox<_TRotation>(initialBBox, currentBBox);
-
-                if (compareResult)
+                if (checkBoundingBox<_TRotation>(initialBBox, nextEntry.bounds))
                 {
                     // Child node intersects with current node, move behind.
-                    ps->nextQuadrantPS = psNext->nextQuadrantPS;
-                    PaintStruct* ps_temp2 = psTemp->nextQuadrantPS;
-                    psTemp->nextQuadrantPS = psNext;
-                    psNext->nextQuadrantPS = ps_temp2;
-                    psNext = ps;
+                    moveSortEntry(entries, next - 1, pos);
                 }
             }
-
-            ps = psTemp;
         }
     }
 
-    static PaintStruct* arrangeStructsHelper(PaintStruct* psNext, uint16_t quadrantIndex, uint8_t flag, uint8_t rotation)
+    static size_t arrangeStructsHelper(std::vector<SortEntry>& entries, size_t entryPos, uint16_t quadrantIndex, uint8_t flag, uint8_t rotation)
     {
         switch (rotation)
         {
             case 0:
-                return arrangeStructsHelperRotation<0>(psNext, quadrantIndex, flag);
+                return arrangeStructsHelperRotation<0>(entries, entryPos, quadrantIndex, flag);
             case 1:
-                return arrangeStructsHelperRotation<1>(psNext, quadrantIndex, flag);
+                return arrangeStructsHelperRotation<1>(entries, entryPos, quadrantIndex, flag);
             case 2:
-                return arrangeStructsHelperRotation<2>(psNext, quadrantIndex, flag);
+                return arrangeStructsHelperRotation<2>(entries, entryPos, quadrantIndex, flag);
             case 3:
-                return arrangeStructsHelperRotation<3>(psNext, quadrantIndex, flag);
+                return arrangeStructsHelperRotation<3>(entries, entryPos, quadrantIndex, flag);
         }
-        return nullptr;
+        return 0;
     }
 
     // 0x0045E7B5
     void PaintSession::arrangeStructs()
     {
+        collectStructs();
+        sortStructs();
+    }
+
+    void PaintSession::collectStructs()
+    {
+        Profiler::ScopedZone zone(Profiler::Zone::paintArrange);
+        const auto numEntries = getNumPaintEntries() - firstPaintEntry;
+        _arenaStats.peakEntries = std::max(_arenaStats.peakEntries, numEntries);
+        _arenaStats.totalEntries += numEntries;
+
+        reservePaintEntries(1);
         _paintHead = _nextFreePaintStruct;
         _nextFreePaintStruct++;
 
-        PaintStruct* ps = &(*_paintHead)->basic;
-        ps->nextQuadrantPS = nullptr;
+        paintHead = _paintHead;
+        paintHead->basic.nextQuadrantPS = nullptr;
+        paintStringHead = _paintStringHead;
+        quadrantBackIndex = _quadrantBackIndex;
+        quadrantFrontIndex = _quadrantFrontIndex;
 
-        uint32_t quadrantIndex = _quadrantBackIndex;
+        sortEntries.clear();
+        uint32_t quadrantIndex = quadrantBackIndex;
         if (quadrantIndex == std::numeric_limits<uint32_t>::max())
         {
             return;
         }
 
+        // Gather the quadrant lists from back to front
         do
         {
-            PaintStruct* psNext = _quadrants[quadrantIndex];
-            if (psNext != nullptr)
+            for (auto* psNext = _quadrants[quadrantIndex]; psNext != nullptr; psNext = psNext->nextQuadrantPS)
             {
-                ps->nextQuadrantPS = psNext;
-                do
-                {
-                    ps = psNext;
-                    psNext = psNext->nextQuadrantPS;
+                sortEntries.push_back(SortEntry{ psNext->bounds, psNext->quadrantIndex, psNext->quadrantFlags, psNext });
+            }
+        } while (++quadrantIndex <= quadrantFrontIndex);
+    }
 
-                } while (psNext != nullptr);
+    void PaintSession::sortStructs()
+    {
+        Profiler::ScopedZone zone(Profiler::Zone::paintArrange);
+        if (quadrantBackIndex == std::numeric_limits<uint32_t>::max())
+        {
+            return;
+        }
+
+        size_t entryPos = arrangeStructsHelper(sortEntries, 0, quadrantBackIndex & 0xFFFF, QuadrantFlags::neighbour, currentRotation);
+
+        uint32_t quadrantIndex = quadrantBackIndex;
+        while (++quadrantIndex < quadrantFrontIndex)
+        {
+            entryPos = arrangeStructsHelper(sortEntries, entryPos, quadrantIndex & 0xFFFF, 0, currentRotation);
+        }
+
+        // Link the paint structs in the sorted order
+        PaintStruct* ps = &paintHead->basic;
+        for (const auto& entry : sortEntries)
+        {
+            entry.ps->quadrantFlags = entry.quadrantFlags;
+            ps->nextQuadrantPS = entry.ps;
+            ps = entry.ps;
+        }
+        ps->nextQuadrantPS = nullptr;
+    }
+
+    static loco_global<int16_t, 0x00E3F0A6> _cutAwayHeight;
+
+    static bool isCutAwayScenery(const InteractionItem type)
+    {
+        switch (type)
+        {
+            case InteractionItem::tree:
+            case InteractionItem::industryTree:
+            case InteractionItem::building:
+            case InteractionItem::headquarterBuilding:
+            case InteractionItem::industry:
+            case InteractionItem::wall:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static bool isCutAwayTrackRoad(const InteractionItem type)
+    {
+        switch (type)
+        {
+            case InteractionItem::track:
+            case InteractionItem::trackExtra:
+            case InteractionItem::signal:
+            case InteractionItem::trackStation:
+            case InteractionItem::roadStation:
+            case InteractionItem::road:
+            case InteractionItem::roadExtra:
+            case InteractionItem::airport:
+            case InteractionItem::dock:
+            case InteractionItem::bridge:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Returns true if the paint struct is in front of the cut-away height and of a type hidden by the view flags.
+    static bool isCutAway(const PaintStruct& ps, const uint16_t viewFlags, const uint8_t rotation)
+    {
+        if (!(viewFlags & (Ui::ViewportFlags::hide_foreground_scenery_buildings | Ui::ViewportFlags::hide_foreground_tracks_roads)))
+        {
+            return false;
+        }
+
+        const auto& bounds = ps.bounds;
+        int16_t depth = 0;
+        switch (rotation)
+        {
+            case 0:
+                depth = bounds.xEnd + bounds.yEnd;
+                break;
+            case 1:
+                depth = bounds.yEnd - bounds.xEnd;
+                break;
+            case 2:
+                depth = -(bounds.yEnd + bounds.xEnd);
+                break;
+            case 3:
+                depth = bounds.xEnd - bounds.yEnd;
+                break;
+        }
+        depth = (depth >> 1) - bounds.z;
+        if (depth <= _cutAwayHeight)
+        {
+            return false;
+        }
+
+        if ((viewFlags & Ui::ViewportFlags::hide_foreground_scenery_buildings) && isCutAwayScenery(ps.type))
+        {
+            return true;
+        }
+        return (viewFlags & Ui::ViewportFlags::hide_foreground_tracks_roads) && isCutAwayTrackRoad(ps.type);
+    }
+
+    // Cut away structs are drawn as see-through glass, or not at all when underground.
+    static std::optional<ImageId> getCutAwayImage(const ImageId imageId, const uint16_t viewFlags)
+    {
+        if ((viewFlags & Ui::ViewportFlags::underground_view) || imageId.isBlended())
+        {
+            return std::nullopt;
+        }
+        return ImageId(imageId.getIndex()).withTranslucency(ExtColour::unk30);
+    }
+
+    static void drawStruct(Gfx::ImageDrawBatch& batch, Gfx::RenderTarget& rt, const PaintStruct& ps, const uint16_t viewFlags, const uint8_t rotation)
+    {
+        auto imageId = ps.imageId;
+        if (isCutAway(ps, viewFlags, rotation))
+        {
+            const auto cutAwayImage = getCutAwayImage(imageId, viewFlags);
+            if (!cutAwayImage.has_value())
+            {
+                return;
             }
-        } while (++quadrantIndex <= _quadrantFrontIndex);
+            imageId = *cutAwayImage;
+        }
 
-        PaintStruct* psCache = arrangeStructsHelper(
-            &(*_paintHead)->basic, _quadrantBackIndex & 0xFFFF, QuadrantFlags::neighbour, currentRotation);
+        auto imagePos = ps.vpPos;
+        if (ps.type == InteractionItem::entity)
+        {
+            // Snap entities to the zoom level so they don't wobble while moving.
+            const auto zoomMask = static_cast<int16_t>(0xFFFF << std::min<uint16_t>(rt.zoomLevel, 3));
+            imagePos.x &= zoomMask;
+            imagePos.y &= zoomMask;
+        }
 
-        quadrantIndex = _quadrantBackIndex;
-        while (++quadrantIndex < _quadrantFrontIndex)
+        if (ps.flags & PaintStructFlags::hasMaskedImage)
+        {
+            Gfx::drawImageMasked(rt, imagePos, imageId, ps.maskedImageId);
+        }
+        else
         {
-            psCache = arrangeStructsHelper(psCache, quadrantIndex & 0xFFFF, 0, currentRotation);
+            batch.draw(imagePos, imageId);
+        }
+    }
+
+    static void drawAttachedStruct(Gfx::ImageDrawBatch& batch, Gfx::RenderTarget& rt, const PaintStruct& ps, const AttachedPaintStruct& attached, const uint16_t viewFlags, const uint8_t rotation)
+    {
+        auto imageId = attached.imageId;
+        if (isCutAway(ps, viewFlags, rotation))
+        {
+            const auto cutAwayImage = getCutAwayImage(imageId, viewFlags);
+            if (!cutAwayImage.has_value())
+            {
+                return;
+            }
+            imageId = *cutAwayImage;
+        }
+
+        auto imagePos = attached.vpPos + ps.vpPos;
+        if (rt.zoomLevel != 0)
+        {
+            imagePos.x &= 0xFFFE;
+            imagePos.y &= 0xFFFE;
+        }
+
+        if (attached.flags & PaintStructFlags::hasMaskedImage)
+        {
+            Gfx::drawImageMasked(rt, imagePos, imageId, attached.maskedImageId);
+        }
+        else
+        {
+            batch.draw(imagePos, imageId);
         }
     }
 
     // 0x0045EA23
     void PaintSession::drawStructs()
     {
-        call(0x0045EA23);
+        Profiler::ScopedZone zone(Profiler::Zone::paintDraw);
+        auto& rt = *renderTarget;
+        Gfx::ImageDrawBatch batch(rt);
+
+        for (const auto* ps = paintHead->basic.nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
+        {
+            // Children are drawn straight after their parent, only the last child draws its attached structs.
+            const auto* child = ps;
+            drawStruct(batch, rt, *child, viewFlags, currentRotation);
+            while (child->children != nullptr)
+            {
+                child = child->children;
+                drawStruct(batch, rt, *child, viewFlags, currentRotation);
+            }
+
+            for (const auto* attached = child->attachedPS; attached != nullptr; attached = attached->next)
+            {
+                drawAttachedStruct(batch, rt, *child, *attached, viewFlags, currentRotation);
+            }
+        }
     }
 
     // 0x00447A5F
@@ -4,6 +4,7 @@
 #include "../Map/Map.hpp"
 #include "../Types.hpp"
 #include "../Ui/Types.hpp"
+#include <vector>
 
 namespace OpenLoco::Map
 {
@@ -140,13 +141,31 @@ namespace OpenLoco::Paint
 
     static constexpr auto kMaxPaintQuadrants = 1024;
 
+    // Compact copy of the sorting relevant parts of a paint struct. arrangeStructs sorts an array of these
+    // instead of walking the quadrant linked list so the comparisons stay within a small contiguous block.
+    struct SortEntry
+    {
+        PaintStructBoundBox bounds;
+        uint16_t quadrantIndex;
+        uint8_t quadrantFlags;
+        PaintStruct* ps;
+    };
+
     struct PaintSession
     {
     public:
         void generate();
         void arrangeStructs();
+        // The two halves of arrangeStructs. collectStructs reads the global quadrants so must run before the
+        // next session is initialised, sortStructs and drawStructs only use this session's own state.
+        void collectStructs();
+        void sortStructs();
         void drawStructs();
         void init(Gfx::RenderTarget& rt, const uint16_t viewportFlags);
+        // Like init but keeps the paint entries of the previous sessions, they stay valid until the next init.
+        void initContinued(Gfx::RenderTarget& rt, const uint16_t viewportFlags);
+        // Points the globals used by the vanilla name and string drawing back at this session.
+        void makeCurrent();
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getNormalInteractionInfo(const uint32_t flags);
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getStationNameInteractionInfo(const uint32_t flags);
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getTownNameInteractionInfo(const uint32_t flags);
@@ -336,6 +355,15 @@ namespace OpenLoco::Paint
         uint8_t currentRotation; // new field set from 0x00E3F0B8 but split out into this struct as seperate item
         uint16_t viewFlags;      // new field set from 0x00E3F0BC
 
+        // Copies of the global state taken by init and collectStructs
+        Gfx::RenderTarget* renderTarget = nullptr;
+        PaintEntry* paintHead = nullptr;
+        PaintStringStruct* paintStringHead = nullptr;
+        uint32_t quadrantBackIndex = 0;
+        uint32_t quadrantFrontIndex = 0;
+        uint32_t firstPaintEntry = 0;
+        std::vector<SortEntry> sortEntries;
+
         // From OpenRCT2 equivalent fields not found yet or new
         // AttachedPaintStruct* unkF1AD2C;              // no equivalent
         // PaintStruct* woodenSupportsPrependTo;
@@ -351,13 +379,16 @@ namespace OpenLoco::Paint
             auto* ps = *_nextFreePaintStruct;
             if (ps >= *_endOfPaintStructArray)
             {
-                return nullptr;
+                ps = allocatePaintChunk();
             }
             *_nextFreePaintStruct = reinterpret_cast<PaintEntry*>(reinterpret_cast<uintptr_t>(*_nextFreePaintStruct) + sizeof(T));
             auto* specificPs = reinterpret_cast<T*>(ps);
             *specificPs = {}; // Zero out the struct
             return specificPs;
         }
+        PaintEntry* allocatePaintChunk();
+        void reservePaintEntries(const size_t count);
+        uint32_t getNumPaintEntries();
         void attachStringStruct(PaintStringStruct& psString);
         void addPSToQuadrant(PaintStruct& ps);
         PaintStruct* createNormalPaintStruct(ImageId imageId, const Map::Pos3& offset, const Map::Pos3& boundBoxOffset, const Map::Pos3& boundBoxSize);
@@ -365,5 +396,16 @@ namespace OpenLoco::Paint
 
     PaintSession* allocateSession(Gfx::RenderTarget& rt, const uint16_t viewportFlags);
 
+    struct PaintArenaStats
+    {
+        uint32_t peakEntries = 0;  // Most entries used by a single session
+        uint32_t totalEntries = 0; // Entries used by all sessions
+        uint32_t numChunks = 1;    // Chunks allocated so far, including the fixed vanilla array
+    };
+
+    // Paint entry usage of the last completed frame
+    const PaintArenaStats& getArenaStats();
+    void endFrame();
+
     void registerHooks();
 }
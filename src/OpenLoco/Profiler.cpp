@@ -0,0 +1,223 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+namespace OpenLoco::Profiler
+{
+    static constexpr const char* kZoneNames[] = {
+        "Tick",
+        "TileManager::update",
+        "WaveManager::update",
+        "TownManager::update",
+        "IndustryManager::update",
+        "EntityManager::updateVehicles",
+        "StationManager::update",
+        "Station::updateCargoAcceptance",
+        "EntityManager::updateMiscEntities",
+        "CompanyManager::update",
+        "AnimationManager::update",
+        "Frame",
+        "Viewport::paint",
+        "PaintSession::generate",
+        "PaintSession::arrangeStructs",
+        "PaintSession::drawStructs",
+    };
+    static_assert(std::size(kZoneNames) == kNumZones);
+
+    // Fixed size history of timings, the newest entry is at (next - 1).
+    struct History
+    {
+        std::array<TickTimings, kHistorySize> entries;
+        size_t next = 0;
+        size_t count = 0;
+
+        void push(const TickTimings& timings)
+        {
+            entries[next] = timings;
+            next = (next + 1) % kHistorySize;
+            count = std::min(count + 1, kHistorySize);
+        }
+
+        const TickTimings& last() const
+        {
+            return entries[(next + kHistorySize - 1) % kHistorySize];
+        }
+
+        TickTimings average(size_t numEntries) const
+        {
+            TickTimings result{};
+            numEntries = std::min(numEntries, count);
+            if (numEntries == 0)
+                return result;
+
+            for (size_t i = 0; i < numEntries; i++)
+            {
+                const auto& entry = entries[(next + kHistorySize - 1 - i) % kHistorySize];
+                result.totalNs += entry.totalNs;
+                for (size_t z = 0; z < kNumZones; z++)
+                {
+                    result.zoneNs[z] += entry.zoneNs[z];
+                }
+            }
+
+            result.startNs = last().startNs;
+            result.totalNs /= numEntries;
+            for (auto& zoneNs : result.zoneNs)
+            {
+                zoneNs /= numEntries;
+            }
+            return result;
+        }
+    };
+
+    static bool _enabled = false;
+    static Clock::time_point _epoch = Clock::now();
+
+    static TickTimings _currentTick;
+    static Clock::time_point _tickStart;
+    static History _tickHistory;
+
+    static TickTimings _currentFrame;
+    static Clock::time_point _frameStart;
+    static History _frameHistory;
+
+    static std::array<Event, kMaxEvents> _events;
+    static size_t _nextEvent = 0;
+    static size_t _numEvents = 0;
+
+    // Zones may end on the viewport paint worker threads
+    static std::mutex _zoneMutex;
+
+    static uint64_t toNanoseconds(Clock::duration duration)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    static void recordEvent(Zone zone, Clock::time_point start, uint64_t durationNs)
+    {
+        _events[_nextEvent] = Event{ zone, toNanoseconds(start - _epoch), durationNs };
+        _nextEvent = (_nextEvent + 1) % kMaxEvents;
+        _numEvents = std::min(_numEvents + 1, kMaxEvents);
+    }
+
+    void setEnabled(bool enabled)
+    {
+        _enabled = enabled;
+    }
+
+    bool isEnabled()
+    {
+        return _enabled;
+    }
+
+    const char* getZoneName(Zone zone)
+    {
+        return kZoneNames[static_cast<size_t>(zone)];
+    }
+
+    void beginTick()
+    {
+        if (!_enabled)
+            return;
+
+        _currentTick = {};
+        _tickStart = Clock::now();
+        _currentTick.startNs = toNanoseconds(_tickStart - _epoch);
+    }
+
+    void endTick()
+    {
+        if (!_enabled)
+            return;
+
+        _currentTick.totalNs = toNanoseconds(Clock::now() - _tickStart);
+        _currentTick.zoneNs[static_cast<size_t>(Zone::tick)] = _currentTick.totalNs;
+        recordEvent(Zone::tick, _tickStart, _currentTick.totalNs);
+        _tickHistory.push(_currentTick);
+    }
+
+    const TickTimings& getLastTick()
+    {
+        return _tickHistory.last();
+    }
+
+    TickTimings getAverageTick(size_t count)
+    {
+        return _tickHistory.average(count);
+    }
+
+    void beginFrame()
+    {
+        if (!_enabled)
+            return;
+
+        _currentFrame = {};
+        _frameStart = Clock::now();
+        _currentFrame.startNs = toNanoseconds(_frameStart - _epoch);
+    }
+
+    void endFrame()
+    {
+        if (!_enabled)
+            return;
+
+        _currentFrame.totalNs = toNanoseconds(Clock::now() - _frameStart);
+        _currentFrame.zoneNs[static_cast<size_t>(Zone::frame)] = _currentFrame.totalNs;
+        recordEvent(Zone::frame, _frameStart, _currentFrame.totalNs);
+        _frameHistory.push(_currentFrame);
+    }
+
+    const TickTimings& getLastFrame()
+    {
+        return _frameHistory.last();
+    }
+
+    TickTimings getAverageFrame(size_t count)
+    {
+        return _frameHistory.average(count);
+    }
+
+    void addZoneTime(Zone zone, Clock::time_point start, Clock::time_point end)
+    {
+        const auto durationNs = toNanoseconds(end - start);
+        std::lock_guard<std::mutex> lock(_zoneMutex);
+        auto& timings = isFrameZone(zone) ? _currentFrame : _currentTick;
+        timings.zoneNs[static_cast<size_t>(zone)] += durationNs;
+        recordEvent(zone, start, durationNs);
+    }
+
+    bool exportChromeTrace(const fs::path& path)
+    {
+        std::ofstream stream(path);
+        if (!stream.is_open())
+        {
+            return false;
+        }
+
+        stream << "{\"traceEvents\":[\n";
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Simulation\"}},\n";
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"Rendering\"}}";
+        const auto firstEvent = (_nextEvent + kMaxEvents - _numEvents) % kMaxEvents;
+        for (size_t i = 0; i < _numEvents; i++)
+        {
+            const auto& event = _events[(firstEvent + i) % kMaxEvents];
+            const auto threadId = isFrameZone(event.zone) || event.zone == Zone::frame ? 2 : 1;
+
+            char buffer[256];
+            std::snprintf(
+                buffer,
+                std::size(buffer),
+                ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                getZoneName(event.zone),
+                threadId,
+                event.startNs / 1000.0,
+                event.durationNs / 1000.0);
+            stream << buffer;
+        }
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return stream.good();
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Core/FileSystem.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenLoco::Profiler
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    enum class Zone : uint8_t
+    {
+        tick,
+        tileManager,
+        waveManager,
+        townManager,
+        industryManager,
+        vehicles,
+        stationManager,
+        stationAcceptance,
+        miscEntities,
+        companyManager,
+        animationManager,
+        frame,
+        viewportPaint,
+        paintGenerate,
+        paintArrange,
+        paintDraw,
+        count
+    };
+
+    constexpr size_t kNumZones = static_cast<size_t>(Zone::count);
+
+    // Number of ticks and frames kept for the overlay and for averaging.
+    constexpr size_t kHistorySize = 4096;
+
+    // Number of individual zone events kept for trace export.
+    constexpr size_t kMaxEvents = 65536;
+
+    // Zones measured during tickLogic, as opposed to the ones measured while drawing a frame.
+    constexpr bool isTickZone(Zone zone)
+    {
+        return zone > Zone::tick && zone < Zone::frame;
+    }
+
+    constexpr bool isFrameZone(Zone zone)
+    {
+        return zone > Zone::frame && zone < Zone::count;
+    }
+
+    struct TickTimings
+    {
+        uint64_t startNs = 0;
+        uint64_t totalNs = 0;
+        std::array<uint64_t, kNumZones> zoneNs{};
+    };
+
+    struct Event
+    {
+        Zone zone;
+        uint64_t startNs;
+        uint64_t durationNs;
+    };
+
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    const char* getZoneName(Zone zone);
+
+    void beginTick();
+    void endTick();
+    const TickTimings& getLastTick();
+    TickTimings getAverageTick(size_t count);
+
+    void beginFrame();
+    void endFrame();
+    const TickTimings& getLastFrame();
+    TickTimings getAverageFrame(size_t count);
+
+    void addZoneTime(Zone zone, Clock::time_point start, Clock::time_point end);
+
+    // Writes all recorded events in the Chrome trace event format, which can be opened
+    // in chrome://tracing or https://ui.perfetto.dev.
+    bool exportChromeTrace(const fs::path& path);
+
+    // Measures the time spent until the end of the enclosing scope and attributes it to the given zone.
+    class ScopedZone
+    {
+    private:
+        Zone _zone;
+        bool _active;
+        Clock::time_point _start;
+
+    public:
+        explicit ScopedZone(Zone zone)
+            : _zone(zone)
+            , _active(isEnabled())
+        {
+            if (_active)
+            {
+                _start = Clock::now();
+            }
+        }
+
+        ~ScopedZone()
+        {
+            if (_active)
+            {
+                addZoneTime(_zone, _start, Clock::now());
+            }
+        }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+    };
+}
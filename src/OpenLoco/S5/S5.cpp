@@ -26,6 +26,7 @@
 #include "../Vehicles/Orders.h"
 #include "../ViewportManager.h"
 #include "SawyerStream.h"
+#include <cassert>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -48,7 +49,7 @@ namespace OpenLoco::S5
     static loco_global<uint8_t, 0x0050C197> _loadErrorCode;
     static loco_global<string_id, 0x0050C198> _loadErrorMessage;
 
-    static bool save(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects);
+    static bool save(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, uint32_t flags = SaveFlags::none);
 
     Options& getOptions()
     {
@@ -242,7 +243,8 @@ namespace OpenLoco::S5
         return save(fs, flags);
     }
 
-    bool save(Stream& stream, uint32_t flags)
+    // Tidies up the live game state before it is copied into a save file.
+    static void prepareGameStateForSave(uint32_t flags)
     {
         if (!(flags & SaveFlags::noWindowClose) && !(flags & SaveFlags::raw) && !(flags & SaveFlags::dump))
         {
@@ -257,6 +259,11 @@ namespace OpenLoco::S5
             StationManager::zeroUnused();
             Vehicles::zeroOrderTable();
         }
+    }
+
+    bool save(Stream& stream, uint32_t flags)
+    {
+        prepareGameStateForSave(flags);
 
         bool saveResult;
         {
@@ -270,7 +277,7 @@ namespace OpenLoco::S5
             }
 
             auto file = prepareSaveFile(flags, requiredObjects, packedObjects);
-            saveResult = save(stream, *file, packedObjects);
+            saveResult = save(stream, *file, packedObjects, flags);
         }
 
         if (!(flags & SaveFlags::raw) && !(flags & SaveFlags::dump))
@@ -292,10 +299,46 @@ namespace OpenLoco::S5
         return false;
     }
 
-    static bool save(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    std::unique_ptr<S5File> createSnapshot(uint32_t flags)
+    {
+        assert(!shouldPackObjects(flags));
+
+        prepareGameStateForSave(flags);
+        auto file = prepareSaveFile(flags, ObjectManager::getHeaders(), {});
+
+        if (!(flags & SaveFlags::raw) && !(flags & SaveFlags::dump))
+        {
+            ObjectManager::reloadAll();
+        }
+
+        Gfx::invalidateScreen();
+        if (!(flags & SaveFlags::raw))
+        {
+            resetScreenAge();
+        }
+        return file;
+    }
+
+    bool saveSnapshot(const fs::path& path, const S5File& file)
     {
         try
         {
+            FileStream fs(path, StreamFlags::write);
+            return save(fs, file, {});
+        }
+        catch (const std::exception& e)
+        {
+            std::fprintf(stderr, "Unable to save S5: %s\n", e.what());
+            return false;
+        }
+    }
+
+    static bool save(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, uint32_t flags)
+    {
+        try
+        {
+            const auto gameStateEncoding = (flags & SaveFlags::compress) ? SawyerEncoding::runLengthMulti : SawyerEncoding::runLengthSingle;
+
             SawyerStreamWriter fs(stream);
             fs.writeChunk(SawyerEncoding::rotate, file.header);
             if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
@@ -314,13 +357,13 @@ namespace OpenLoco::S5
 
             if (file.header.type == S5Type::scenario)
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.rng, 0xB96C);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
+                fs.writeChunk(gameStateEncoding, file.gameState.rng, 0xB96C);
+                fs.writeChunk(gameStateEncoding, file.gameState.towns, 0x123480);
+                fs.writeChunk(gameStateEncoding, file.gameState.animations, 0x79D80);
             }
             else
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+                fs.writeChunk(gameStateEncoding, file.gameState);
             }
 
             if (file.header.flags & SaveFlags::raw)
@@ -382,15 +425,16 @@ namespace OpenLoco::S5
         }
     }
 
-    // 0x00441FC9
-    static std::unique_ptr<S5File> load(Stream& stream)
+    // Decodes the tile element chunk straight into elements, anything beyond the maximum number of elements is dropped.
+    static void readTileElements(SawyerStreamReader& fs, std::vector<TileElement>& elements)
     {
-        SawyerStreamReader fs(stream);
-        if (!fs.validateChecksum())
-        {
-            throw std::runtime_error("Invalid checksum");
-        }
+        elements.resize(TileManager::maxElements);
+        auto length = fs.readChunk(elements.data(), elements.size() * sizeof(TileElement));
+        elements.resize(std::min(length / sizeof(TileElement), elements.size()));
+    }
 
+    static std::unique_ptr<S5File> readFile(SawyerStreamReader& fs)
+    {
         auto file = std::make_unique<S5File>();
 
         // Read header
@@ -440,10 +484,7 @@ namespace OpenLoco::S5
             if (file->gameState.flags & (1 << 0))
             {
                 // Load tile elements
-                auto tileElements = fs.readChunk();
-                auto numTileElements = tileElements.size() / sizeof(TileElement);
-                file->tileElements.resize(numTileElements);
-                std::memcpy(file->tileElements.data(), tileElements.data(), numTileElements * sizeof(TileElement));
+                readTileElements(fs, file->tileElements);
             }
         }
         else
@@ -456,12 +497,36 @@ namespace OpenLoco::S5
             fixState(file->gameState);
 
             // Load tile elements
-            auto tileElements = fs.readChunk();
-            auto numTileElements = tileElements.size() / sizeof(TileElement);
-            file->tileElements.resize(numTileElements);
-            std::memcpy(file->tileElements.data(), tileElements.data(), numTileElements * sizeof(TileElement));
+            readTileElements(fs, file->tileElements);
+        }
+
+        return file;
+    }
+
+    // 0x00441FC9
+    static std::unique_ptr<S5File> load(Stream& stream)
+    {
+        SawyerStreamReader fs(stream);
+        std::unique_ptr<S5File> file;
+        try
+        {
+            file = readFile(fs);
+        }
+        catch (const std::exception&)
+        {
+            // Corrupt files should be reported as such rather than by whichever chunk failed to decode
+            if (!fs.validateChecksum())
+            {
+                throw std::runtime_error("Invalid checksum");
+            }
+            throw;
         }
 
+        // The checksum is summed while reading so the file only has to be read once
+        if (!fs.validateReadChecksum())
+        {
+            throw std::runtime_error("Invalid checksum");
+        }
         return file;
     }
 
@@ -650,10 +715,12 @@ namespace OpenLoco::S5
             }
 
             EntityManager::resetSpatialIndex();
+            EntityManager::rebuildDenseLists();
             CompanyManager::updateColours();
             call(0x004748FA);
             TileManager::resetSurfaceClearance();
             IndustryManager::createAllMapAnimations();
+            StationManager::resetCatchmentIndex();
             Audio::resetSoundObjects();
 
             if (flags & LoadFlags::scenario)
@@ -421,6 +421,7 @@ namespace OpenLoco::S5
         constexpr uint32_t packCustomObjects = 1 << 0;
         constexpr uint32_t scenario = 1 << 1;
         constexpr uint32_t landscape = 1 << 2;
+        constexpr uint32_t compress = 1u << 28; // Smaller but slower to write, used for network transfers
         constexpr uint32_t noWindowClose = 1u << 29;
         constexpr uint32_t raw = 1u << 30;  // Save raw data including pointers with no clean up
         constexpr uint32_t dump = 1u << 31; // Used for dumping the game state when there is a fatal error
@@ -436,6 +437,12 @@ namespace OpenLoco::S5
     Options& getPreviewOptions();
     bool save(const fs::path& path, uint32_t flags);
     bool save(Stream& stream, uint32_t flags);
+
+    // Copies the game state into a standalone save file, must be called on the game thread.
+    // Saving with packed custom objects is not supported.
+    std::unique_ptr<S5File> createSnapshot(uint32_t flags);
+    // Encodes and writes a file from createSnapshot. Only reads the snapshot so it can run on any thread.
+    bool saveSnapshot(const fs::path& path, const S5File& file);
     void registerHooks();
 
     bool load(const fs::path& path, uint32_t flags);
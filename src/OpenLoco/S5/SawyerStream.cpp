@@ -21,6 +21,35 @@ constexpr const char* exceptionWriteError = "Failed to write data to stream";
 constexpr const char* exceptionInvalidRLE = "Invalid RLE run";
 constexpr const char* exceptionUnknownEncoding = "Unknown encoding";
 
+// Adds up all the bytes for the checksum, eight at a time in 16 bit lanes.
+static uint32_t sumBytes(const uint8_t* data, size_t len)
+{
+    constexpr uint64_t kLowBytes = 0x00FF00FF00FF00FFULL;
+    // Each lane gains at most 2 * 255 per word, so add them up before they can overflow
+    constexpr size_t kWordsPerFold = 128;
+
+    uint32_t sum = 0;
+    size_t i = 0;
+    while (len - i >= 8)
+    {
+        uint64_t lanes = 0;
+        const auto numWords = std::min(kWordsPerFold, (len - i) / 8);
+        for (size_t j = 0; j < numWords; j++, i += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            lanes += (word & kLowBytes) + ((word >> 8) & kLowBytes);
+        }
+        lanes = (lanes & 0x0000FFFF0000FFFFULL) + ((lanes >> 16) & 0x0000FFFF0000FFFFULL);
+        sum += static_cast<uint32_t>(lanes) + static_cast<uint32_t>(lanes >> 32);
+    }
+    for (; i < len; i++)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
 uint8_t* FastBuffer::alloc(size_t len)
 {
 #ifdef _WIN32
@@ -128,6 +157,7 @@ stdx::span<uint8_t const> FastBuffer::getSpan() const
 SawyerStreamReader::SawyerStreamReader(Stream& stream)
 {
     _stream = &stream;
+    _startPosition = _stream->getPosition();
 }
 
 SawyerStreamReader::SawyerStreamReader(const fs::path& path)
@@ -136,7 +166,8 @@ SawyerStreamReader::SawyerStreamReader(const fs::path& path)
     _stream = _fstream.get();
 }
 
-stdx::span<uint8_t const> SawyerStreamReader::readChunk()
+// Reads the encoded data of the next chunk into _decodeBuffer
+SawyerEncoding SawyerStreamReader::readChunkData()
 {
     SawyerEncoding encoding;
     read(&encoding, sizeof(encoding));
@@ -146,13 +177,26 @@ stdx::span<uint8_t const> SawyerStreamReader::readChunk()
 
     _decodeBuffer.resize(length);
     read(_decodeBuffer.data(), length);
+    return encoding;
+}
 
+stdx::span<uint8_t const> SawyerStreamReader::readChunk()
+{
+    auto encoding = readChunkData();
     return decode(encoding, _decodeBuffer.getSpan());
 }
 
 size_t SawyerStreamReader::readChunk(void* data, size_t maxDataLen)
 {
-    auto chunkData = readChunk();
+    auto encoding = readChunkData();
+    auto decodedLen = decodeInto(encoding, _decodeBuffer.getSpan(), stdx::span<uint8_t>(reinterpret_cast<uint8_t*>(data), maxDataLen));
+    if (decodedLen.has_value())
+    {
+        return *decodedLen;
+    }
+
+    // Chunk is larger than the destination, decode it in full to truncate it
+    auto chunkData = decode(encoding, _decodeBuffer.getSpan());
     std::memcpy(data, chunkData.data(), std::min(chunkData.size(), maxDataLen));
     return chunkData.size();
 }
@@ -167,6 +211,7 @@ void SawyerStreamReader::read(void* data, size_t dataLen)
     {
         throw std::runtime_error(exceptionReadError);
     }
+    _checksum += sumBytes(reinterpret_cast<const uint8_t*>(data), dataLen);
 }
 
 bool SawyerStreamReader::validateChecksum()
@@ -189,10 +234,7 @@ bool SawyerStreamReader::validateChecksum()
         {
             auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
             _stream->read(buffer, readLength);
-            for (size_t j = 0; j < readLength; j++)
-            {
-                actualChecksum += buffer[j];
-            }
+            actualChecksum += sumBytes(buffer, readLength);
         }
 
         valid = checksum == actualChecksum;
@@ -204,6 +246,29 @@ bool SawyerStreamReader::validateChecksum()
     return valid;
 }
 
+bool SawyerStreamReader::validateReadChecksum()
+{
+    const auto fileLength = _stream->getLength();
+    auto position = _stream->getPosition();
+    if (_startPosition != 0 || fileLength < 4 || position > fileLength - 4)
+    {
+        // The bytes read so far do not cover the file up to the checksum
+        return validateChecksum();
+    }
+
+    uint8_t buffer[2048];
+    while (position < fileLength - 4)
+    {
+        auto readLength = static_cast<size_t>(std::min<uint64_t>(sizeof(buffer), fileLength - 4 - position));
+        read(buffer, readLength);
+        position += readLength;
+    }
+
+    uint32_t checksum;
+    _stream->read(&checksum, sizeof(checksum));
+    return checksum == _checksum;
+}
+
 void SawyerStreamReader::close()
 {
     _fstream = {};
@@ -315,6 +380,183 @@ void SawyerStreamReader::decodeRotate(FastBuffer& buffer, stdx::span<uint8_t con
     }
 }
 
+std::optional<size_t> SawyerStreamReader::decodeInto(SawyerEncoding encoding, stdx::span<uint8_t const> data, stdx::span<uint8_t> dst)
+{
+    switch (encoding)
+    {
+        case SawyerEncoding::uncompressed:
+            if (data.size() > dst.size())
+            {
+                return std::nullopt;
+            }
+            std::memcpy(dst.data(), data.data(), data.size());
+            return data.size();
+        case SawyerEncoding::runLengthSingle:
+            return decodeRunLengthSingleInto(data, dst);
+        case SawyerEncoding::runLengthMulti:
+            return decodeRunLengthMultiInto(data, dst);
+        case SawyerEncoding::rotate:
+            return decodeRotateInto(data, dst);
+        default:
+            throw std::runtime_error(exceptionUnknownEncoding);
+    }
+}
+
+std::optional<size_t> SawyerStreamReader::decodeRunLengthSingleInto(stdx::span<uint8_t const> data, stdx::span<uint8_t> dst)
+{
+    size_t dstLen = 0;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        uint8_t rleCodeByte = data[i];
+        if (rleCodeByte & 128)
+        {
+            i++;
+            if (i >= data.size())
+            {
+                throw std::runtime_error(exceptionInvalidRLE);
+            }
+
+            // Runs are checked once and filled in one go
+            auto copyLen = static_cast<size_t>(257 - rleCodeByte);
+            if (copyLen > dst.size() - dstLen)
+            {
+                return std::nullopt;
+            }
+            std::memset(dst.data() + dstLen, data[i], copyLen);
+            dstLen += copyLen;
+        }
+        else
+        {
+            if (i + 1 >= data.size() || i + 1 + rleCodeByte + 1 > data.size())
+            {
+                throw std::runtime_error(exceptionInvalidRLE);
+            }
+
+            auto copyLen = static_cast<size_t>(rleCodeByte + 1);
+            if (copyLen > dst.size() - dstLen)
+            {
+                return std::nullopt;
+            }
+            std::memcpy(dst.data() + dstLen, &data[i + 1], copyLen);
+            dstLen += copyLen;
+            i += rleCodeByte + 1;
+        }
+    }
+    return dstLen;
+}
+
+/**
+ * Produces the output of the single byte run length decoding one byte at a time, so that
+ * the multi byte decoding can consume it without an intermediate buffer.
+ */
+class RunLengthSingleReader
+{
+private:
+    stdx::span<uint8_t const> _data;
+    size_t _index{};
+    size_t _remaining{};
+    const uint8_t* _literal{};
+    uint8_t _runByte{};
+
+public:
+    RunLengthSingleReader(stdx::span<uint8_t const> data)
+        : _data(data)
+    {
+    }
+
+    bool next(uint8_t& value)
+    {
+        if (_remaining == 0)
+        {
+            if (_index >= _data.size())
+            {
+                return false;
+            }
+
+            uint8_t rleCodeByte = _data[_index++];
+            if (rleCodeByte & 128)
+            {
+                if (_index >= _data.size())
+                {
+                    throw std::runtime_error(exceptionInvalidRLE);
+                }
+                _literal = nullptr;
+                _runByte = _data[_index++];
+                _remaining = static_cast<size_t>(257 - rleCodeByte);
+            }
+            else
+            {
+                if (_index + rleCodeByte + 1 > _data.size())
+                {
+                    throw std::runtime_error(exceptionInvalidRLE);
+                }
+                _literal = &_data[_index];
+                _remaining = static_cast<size_t>(rleCodeByte + 1);
+                _index += rleCodeByte + 1;
+            }
+        }
+
+        _remaining--;
+        value = _literal != nullptr ? *_literal++ : _runByte;
+        return true;
+    }
+};
+
+std::optional<size_t> SawyerStreamReader::decodeRunLengthMultiInto(stdx::span<uint8_t const> data, stdx::span<uint8_t> dst)
+{
+    RunLengthSingleReader reader(data);
+    size_t dstLen = 0;
+    uint8_t code;
+    while (reader.next(code))
+    {
+        if (code == 0xFF)
+        {
+            uint8_t value;
+            if (!reader.next(value))
+            {
+                throw std::runtime_error(exceptionInvalidRLE);
+            }
+            if (dstLen >= dst.size())
+            {
+                return std::nullopt;
+            }
+            dst[dstLen++] = value;
+        }
+        else
+        {
+            auto offset = static_cast<size_t>(32 - (code >> 3));
+            if (offset > dstLen)
+            {
+                throw std::runtime_error(exceptionInvalidRLE);
+            }
+            auto copyLen = static_cast<size_t>((code & 7) + 1);
+            if (copyLen > dst.size() - dstLen)
+            {
+                return std::nullopt;
+            }
+            std::memmove(dst.data() + dstLen, dst.data() + dstLen - offset, copyLen);
+            dstLen += copyLen;
+        }
+    }
+    return dstLen;
+}
+
+std::optional<size_t> SawyerStreamReader::decodeRotateInto(stdx::span<uint8_t const> data, stdx::span<uint8_t> dst)
+{
+    if (data.size() > dst.size())
+    {
+        return std::nullopt;
+    }
+
+    uint8_t code = 1;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        dst[i] = OpenLoco::Utility::ror(data[i], code);
+        code = (code + 2) & 7;
+    }
+    return data.size();
+}
+
 SawyerStreamWriter::SawyerStreamWriter(Stream& stream)
 {
     _stream = &stream;
@@ -337,11 +579,7 @@ void SawyerStreamWriter::writeChunk(SawyerEncoding chunkType, const void* data,
 void SawyerStreamWriter::write(const void* data, size_t dataLen)
 {
     writeStream(data, dataLen);
-    auto data8 = reinterpret_cast<const uint8_t*>(data);
-    for (size_t i = 0; i < dataLen; i++)
-    {
-        _checksum += data8[i];
-    }
+    _checksum += sumBytes(reinterpret_cast<const uint8_t*>(data), dataLen);
 }
 
 void SawyerStreamWriter::writeChecksum()
@@ -445,6 +683,37 @@ void SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<ui
     }
 }
 
+// Returns the number of equal leading bytes of a and b, at most maxLen (which is at most 8).
+static size_t getMatchLength(const uint8_t* a, const uint8_t* b, size_t maxLen, bool canReadWord)
+{
+    if (canReadWord)
+    {
+        // Compare all 8 bytes at once, the first differing byte is the lowest set bit (little endian).
+        uint32_t a0, a1, b0, b1;
+        std::memcpy(&a0, a, 4);
+        std::memcpy(&a1, a + 4, 4);
+        std::memcpy(&b0, b, 4);
+        std::memcpy(&b1, b + 4, 4);
+        size_t length = 8;
+        if (const auto diff0 = a0 ^ b0; diff0 != 0)
+        {
+            length = Utility::bitScanForward(diff0) / 8;
+        }
+        else if (const auto diff1 = a1 ^ b1; diff1 != 0)
+        {
+            length = 4 + Utility::bitScanForward(diff1) / 8;
+        }
+        return std::min(length, maxLen);
+    }
+
+    size_t length = 0;
+    while (length < maxLen && a[length] == b[length])
+    {
+        length++;
+    }
+    return length;
+}
+
 void SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data)
 {
     auto src = data.data();
@@ -460,34 +729,25 @@ void SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uin
     for (size_t i = 1; i < srcLen;)
     {
         size_t searchIndex = (i < 32) ? 0 : (i - 32);
-        size_t searchEnd = i - 1;
+        const uint8_t first = src[i];
+        // Repeats can not overlap the current position and can be at most 8 bytes long
+        const size_t maxLength = std::min(static_cast<size_t>(8), srcLen - i);
+        const bool canReadWord = i + 8 <= srcLen;
 
+        // Earliest position wins when repeats are equally long
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+        for (size_t repeatIndex = searchIndex; repeatIndex < i; repeatIndex++)
         {
-            size_t repeatCount = 0;
-            size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), srcLen - i - 1);
-            // maxRepeatCount should not exceed srcLen
-            assert(repeatIndex + maxRepeatCount < srcLen);
-            assert(i + maxRepeatCount < srcLen);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
-            {
-                if (src[repeatIndex + j] == src[i + j])
-                {
-                    repeatCount++;
-                }
-                else
-                {
-                    break;
-                }
-            }
+            if (src[repeatIndex] != first)
+                continue;
+
+            const auto repeatCount = getMatchLength(src + repeatIndex, src + i, std::min(maxLength, i - repeatIndex), canReadWord);
             if (repeatCount > bestRepeatCount)
             {
                 bestRepeatIndex = repeatIndex;
                 bestRepeatCount = repeatCount;
 
-                // Maximum repeat count is 8
                 if (repeatCount == 8)
                     break;
             }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Core/FileSystem.hpp"
+#include "../Core/Optional.hpp"
 #include "../Core/Span.hpp"
 #include "../Utility/Stream.hpp"
 #include <cstdint>
@@ -56,20 +57,33 @@ namespace OpenLoco
         std::unique_ptr<FileStream> _fstream;
         FastBuffer _decodeBuffer;
         FastBuffer _decodeBuffer2;
+        uint64_t _startPosition{};
+        uint32_t _checksum{};
 
+        SawyerEncoding readChunkData();
         stdx::span<uint8_t const> decode(SawyerEncoding encoding, stdx::span<uint8_t const> data);
         static void decodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void decodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void decodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data);
 
+        // Decode straight into dst in a single pass, std::nullopt is returned if the result does not fit.
+        static std::optional<size_t> decodeInto(SawyerEncoding encoding, stdx::span<uint8_t const> data, stdx::span<uint8_t> dst);
+        static std::optional<size_t> decodeRunLengthSingleInto(stdx::span<uint8_t const> data, stdx::span<uint8_t> dst);
+        static std::optional<size_t> decodeRunLengthMultiInto(stdx::span<uint8_t const> data, stdx::span<uint8_t> dst);
+        static std::optional<size_t> decodeRotateInto(stdx::span<uint8_t const> data, stdx::span<uint8_t> dst);
+
     public:
         SawyerStreamReader(Stream& stream);
         SawyerStreamReader(const fs::path& path);
 
         stdx::span<uint8_t const> readChunk();
+        // Decodes the next chunk directly into data, returns the full decoded length of the chunk.
         size_t readChunk(void* data, size_t maxDataLen);
         void read(void* data, size_t dataLen);
         bool validateChecksum();
+        // Validates the checksum against the bytes read so far, reading only what remains before
+        // the checksum. Saves reading the whole file twice when the file is read from the start.
+        bool validateReadChecksum();
         void close();
     };
 
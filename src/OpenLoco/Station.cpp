@@ -13,6 +13,7 @@
 #include "Objects/ObjectManager.h"
 #include "Objects/RoadStationObject.h"
 #include "OpenLoco.h"
+#include "Profiler.h"
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "ViewportManager.h"
@@ -39,6 +40,8 @@ namespace OpenLoco
         inline static loco_global<uint32_t, 0x0112C710> _producedCargoTypes;
         inline static loco_global<IndustryId[kMaxCargoStats], 0x0112C7D2> _industry;
         inline static loco_global<uint8_t, 0x0112C7F2> _byte_112C7F2;
+        inline static TilePos2 _regionMin{ kMapColumns, kMapRows };
+        inline static TilePos2 _regionMax{ -1, -1 };
 
     public:
         bool mapHas2(const tile_coord_t x, const tile_coord_t y) const
@@ -63,44 +66,53 @@ namespace OpenLoco
 
         void setTileRegion(tile_coord_t x, tile_coord_t y, int16_t xTileCount, int16_t yTileCount, const uint8_t flag)
         {
-            auto xStart = x;
-            auto xTileStartCount = xTileCount;
-            while (yTileCount > 0)
+            if (xTileCount <= 0 || yTileCount <= 0)
             {
-                while (xTileCount > 0)
-                {
-                    setTile(x, y, flag);
-                    x++;
-                    xTileCount--;
-                }
+                return;
+            }
 
-                x = xStart;
-                xTileCount = xTileStartCount;
-                y++;
-                yTileCount--;
+            for (auto row = y; row < y + yTileCount; row++)
+            {
+                auto* begin = &_map[row * kMapColumns + x];
+                std::for_each(begin, begin + xTileCount, [flag](uint8_t& tile) { tile |= (1 << flag); });
             }
+
+            _regionMin.x = std::min<coord_t>(_regionMin.x, x);
+            _regionMin.y = std::min<coord_t>(_regionMin.y, y);
+            _regionMax.x = std::max<coord_t>(_regionMax.x, x + xTileCount - 1);
+            _regionMax.y = std::max<coord_t>(_regionMax.y, y + yTileCount - 1);
         }
 
         void resetTileRegion(tile_coord_t x, tile_coord_t y, int16_t xTileCount, int16_t yTileCount, const uint8_t flag)
         {
-            auto xStart = x;
-            auto xTileStartCount = xTileCount;
-            while (yTileCount > 0)
+            if (xTileCount <= 0 || yTileCount <= 0)
             {
-                while (xTileCount > 0)
-                {
-                    resetTile(x, y, flag);
-                    x++;
-                    xTileCount--;
-                }
+                return;
+            }
 
-                x = xStart;
-                xTileCount = xTileStartCount;
-                y++;
-                yTileCount--;
+            // Full rows are contiguous so they can be reset in one go
+            const auto rowCount = xTileCount == kMapColumns ? 1 : yTileCount;
+            const auto rowLength = xTileCount == kMapColumns ? kMapColumns * yTileCount : xTileCount;
+            for (auto row = y; row < y + rowCount; row++)
+            {
+                auto* begin = &_map[row * kMapColumns + x];
+                std::for_each(begin, begin + rowLength, [flag](uint8_t& tile) { tile &= ~(1 << flag); });
+            }
+
+            if (x == 0 && y == 0 && xTileCount == kMapColumns && yTileCount == kMapRows)
+            {
+                _regionMin = TilePos2(kMapColumns, kMapRows);
+                _regionMax = TilePos2(-1, -1);
             }
         }
 
+        // Bounds of the regions set (for any flag) since the whole map was last reset. Only regions set
+        // by native code are tracked, so this is only valid right after a native reset of the whole map.
+        std::pair<TilePos2, TilePos2> getRegionBounds() const
+        {
+            return { _regionMin, _regionMax };
+        }
+
         uint32_t filter() const
         {
             return _filter;
@@ -174,6 +186,8 @@ namespace OpenLoco
     // 0x00492640
     void Station::updateCargoAcceptance()
     {
+        Profiler::ScopedZone zone(Profiler::Zone::stationAcceptance);
+
         CargoSearchState cargoSearchState;
         uint32_t currentAcceptedCargo = calcAcceptedCargo(cargoSearchState);
         uint32_t originallyAcceptedCargo = 0;
@@ -290,9 +304,11 @@ namespace OpenLoco
             cargoSearchState.filter(~0);
         }
 
-        for (tile_coord_t ty = 0; ty < kMapColumns; ty++)
+        // setCatchmentDisplay has just reset the whole map, so only tiles within the regions set since can be marked
+        const auto [regionMin, regionMax] = cargoSearchState.getRegionBounds();
+        for (tile_coord_t ty = regionMin.y; ty <= regionMax.y; ty++)
         {
-            for (tile_coord_t tx = 0; tx < kMapRows; tx++)
+            for (tile_coord_t tx = regionMin.x; tx <= regionMax.x; tx++)
             {
                 if (cargoSearchState.mapHas2(tx, ty))
                 {
@@ -417,22 +433,13 @@ namespace OpenLoco
 
     static void setStationCatchmentRegion(CargoSearchState& cargoSearchState, TilePos2 minPos, TilePos2 maxPos, const uint8_t flags);
 
-    // 0x00491D70
-    // catchment flag should not be shifted (1, 2, 3, 4) and NOT (1 << 0, 1 << 1)
-    void Station::setCatchmentDisplay(const uint8_t catchmentFlag)
+    // Calls func with the tile bounds of the catchment around each station tile
+    template<typename TFunc>
+    static void forEachCatchmentRegion(const Station& station, TFunc&& func)
     {
-        CargoSearchState cargoSearchState;
-        cargoSearchState.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
-
-        if (this == (Station*)0xFFFFFFFF)
-            return;
-
-        if (stationTileSize == 0)
-            return;
-
-        for (uint16_t i = 0; i < stationTileSize; i++)
+        for (uint16_t i = 0; i < station.stationTileSize; i++)
         {
-            auto pos = stationTiles[i];
+            auto pos = station.stationTiles[i];
             pos.z &= ~((1 << 1) | (1 << 0));
 
             auto stationElement = getStationElement(pos);
@@ -475,7 +482,7 @@ namespace OpenLoco
                     tileMaxPos.x += catchmentSize;
                     tileMaxPos.y += catchmentSize;
 
-                    setStationCatchmentRegion(cargoSearchState, tileMinPos, tileMaxPos, catchmentFlag);
+                    func(tileMinPos, tileMaxPos);
                 }
                 break;
                 case StationType::docks:
@@ -489,7 +496,7 @@ namespace OpenLoco
                     maxPos.x += catchmentSize + 1;
                     maxPos.y += catchmentSize + 1;
 
-                    setStationCatchmentRegion(cargoSearchState, minPos, maxPos, catchmentFlag);
+                    func(minPos, maxPos);
                 }
                 break;
                 default:
@@ -502,12 +509,36 @@ namespace OpenLoco
                     maxPos.x += catchmentSize;
                     maxPos.y += catchmentSize;
 
-                    setStationCatchmentRegion(cargoSearchState, minPos, maxPos, catchmentFlag);
+                    func(minPos, maxPos);
                 }
             }
         }
     }
 
+    // 0x00491D70
+    // catchment flag should not be shifted (1, 2, 3, 4) and NOT (1 << 0, 1 << 1)
+    void Station::setCatchmentDisplay(const uint8_t catchmentFlag)
+    {
+        CargoSearchState cargoSearchState;
+        cargoSearchState.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
+
+        if (this == (Station*)0xFFFFFFFF)
+            return;
+
+        forEachCatchmentRegion(*this, [&cargoSearchState, catchmentFlag](const TilePos2& minPos, const TilePos2& maxPos) {
+            setStationCatchmentRegion(cargoSearchState, minPos, maxPos, catchmentFlag);
+        });
+    }
+
+    std::vector<std::pair<TilePos2, TilePos2>> Station::getCatchmentRegions() const
+    {
+        std::vector<std::pair<TilePos2, TilePos2>> regions;
+        forEachCatchmentRegion(*this, [&regions](const TilePos2& minPos, const TilePos2& maxPos) {
+            regions.emplace_back(minPos, maxPos);
+        });
+        return regions;
+    }
+
     // 0x0049B4E0
     void Station::deliverCargoToTown(uint8_t cargoType, uint16_t cargoQuantity)
     {
@@ -562,7 +593,7 @@ namespace OpenLoco
     }
 
     // 0x00492793
-    bool Station::updateCargo()
+    StationCargoUpdate Station::updateCargoRatings(Utility::prng& rng)
     {
         bool atLeastOneGoodRating = false;
         bool quantityUpdated = false;
@@ -570,7 +601,6 @@ namespace OpenLoco
         var_3B0 = std::min(var_3B0 + 1, 255);
         var_3B1 = std::min(var_3B1 + 1, 255);
 
-        auto& rng = gPrng();
         for (uint32_t i = 0; i < kMaxCargoStats; i++)
         {
             auto& stationCargo = cargoStats[i];
@@ -623,15 +653,27 @@ namespace OpenLoco
             }
         }
 
-        updateCargoDistribution();
+        StationCargoUpdate update;
+        update.atLeastOneGoodRating = atLeastOneGoodRating;
+        update.quantityUpdated = quantityUpdated;
+        update.densityChanged = updateCargoDensity();
+        return update;
+    }
+
+    // The station list is left for the caller to invalidate once for all stations
+    void Station::applyCargoUpdate(const StationCargoUpdate& update)
+    {
+        invalidateWindow();
+        if (update.densityChanged)
+        {
+            invalidateCargoTiles();
+        }
 
         auto w = WindowManager::find(WindowType::station, enumValue(id()));
-        if (w != nullptr && (w->currentTab == 2 || w->currentTab == 1 || quantityUpdated))
+        if (w != nullptr && (w->currentTab == 2 || w->currentTab == 1 || update.quantityUpdated))
         {
             w->invalidate();
         }
-
-        return atLeastOneGoodRating;
     }
 
     // 0x004927F6
@@ -712,6 +754,15 @@ namespace OpenLoco
     {
         invalidateWindow();
         WindowManager::invalidate(Ui::WindowType::stationList);
+        if (updateCargoDensity())
+        {
+            invalidateCargoTiles();
+        }
+    }
+
+    // Returns true if the amount of cargo shown on the station tiles has changed
+    bool Station::updateCargoDensity()
+    {
         bool hasChanged = false;
         for (uint8_t i = 0; i < kMaxCargoStats; ++i)
         {
@@ -736,13 +787,15 @@ namespace OpenLoco
             }
         }
 
-        if (hasChanged)
+        return hasChanged;
+    }
+
+    void Station::invalidateCargoTiles()
+    {
+        for (auto i = 0; i < stationTileSize; ++i)
         {
-            for (auto i = 0; i < stationTileSize; ++i)
-            {
-                const auto& tile = stationTiles[i];
-                Ui::ViewportManager::invalidate({ tile.x, tile.y }, tile.z & 0xFFFC, tile.z + 32, ZoomLevel::full);
-            }
+            const auto& tile = stationTiles[i];
+            Ui::ViewportManager::invalidate({ tile.x, tile.y }, tile.z & 0xFFFC, tile.z + 32, ZoomLevel::full);
         }
     }
 
@@ -6,8 +6,11 @@
 #include "Speed.hpp"
 #include "Types.hpp"
 #include "Utility/Numeric.hpp"
+#include "Utility/Prng.hpp"
 #include <cstdint>
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace OpenLoco
 {
@@ -69,6 +72,14 @@ namespace OpenLoco
 
     struct CargoSearchState;
 
+    // Result of Station::updateCargoRatings, applied afterwards by Station::applyCargoUpdate
+    struct StationCargoUpdate
+    {
+        bool atLeastOneGoodRating = false;
+        bool quantityUpdated = false;
+        bool densityChanged = false;
+    };
+
     struct Station
     {
         string_id name = StringIds::null; // 0x00
@@ -98,12 +109,16 @@ namespace OpenLoco
         uint32_t calcAcceptedCargo(CargoSearchState& cargoSearchState, const Map::Pos2& location = { -1, -1 }, const uint32_t filter = 0);
         void sub_48F7D1();
         char* getStatusString(char* buffer);
-        bool updateCargo();
+        // The daily cargo update is split so that updateCargoRatings only touches this station and can run
+        // alongside other stations, while applyCargoUpdate invalidates the windows and viewports afterwards.
+        StationCargoUpdate updateCargoRatings(Utility::prng& rng);
+        void applyCargoUpdate(const StationCargoUpdate& update);
         int32_t calculateCargoRating(const StationCargoStats& cargo) const;
         void updateLabel();
         void invalidate();
         void invalidateWindow();
         void setCatchmentDisplay(uint8_t flags);
+        std::vector<std::pair<Map::TilePos2, Map::TilePos2>> getCatchmentRegions() const;
         void deliverCargoToStation(const uint8_t cargoType, const uint8_t cargoQuantity);
         void deliverCargoToTown(uint8_t cargoType, uint16_t cargoQuantity);
         void updateCargoDistribution();
@@ -111,6 +126,8 @@ namespace OpenLoco
     private:
         void updateCargoAcceptance();
         void alertCargoAcceptanceChange(uint32_t oldCargoAcc, uint32_t newCargoAcc);
+        bool updateCargoDensity();
+        void invalidateCargoTiles();
     };
     static_assert(sizeof(Station) == 0x3D2);
 #pragma pack(pop)
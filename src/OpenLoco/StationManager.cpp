@@ -1,5 +1,6 @@
 #include "StationManager.h"
 #include "CompanyManager.h"
+#include "Core/Span.hpp"
 #include "Game.h"
 #include "GameState.h"
 #include "IndustryManager.h"
@@ -8,14 +9,17 @@
 #include "Localisation/StringIds.h"
 #include "Map/TileManager.h"
 #include "Objects/IndustryObject.h"
+#include "OpenLoco.h"
 #include "ScenarioManager.h"
 #include "SceneManager.h"
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "Window.h"
 
+#include <algorithm>
 #include <bitset>
 #include <numeric>
+#include <thread>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui;
@@ -25,9 +29,35 @@ namespace OpenLoco::StationManager
 {
     static auto& rawStations() { return getGameState().stations; }
 
+    static std::bitset<Limits::kMaxStations> _acceptanceInvalidated;
+    // Tiles with a new element, each queued once per tick
+    static std::vector<TilePos2> _queuedAcceptanceChecks;
+    static std::bitset<kMapSize> _acceptanceCheckQueued;
+    // Tiles whose stations are looked up through the catchment index, each queued once per tick
+    static std::vector<TilePos2> _invalidatedTiles;
+    static std::bitset<kMapSize> _tileInvalidated;
+    static std::bitset<Limits::kMaxIndustries> _industryInvalidated;
+
+    // Most stations that cargo is delivered to from a single building
+    constexpr size_t kMaxNearbyStations = 16;
+
+    // Stations whose catchment covers each tile, sorted by id. Empty until first used after a reset.
+    static std::vector<std::vector<StationId>> _catchmentIndex;
+    // Catchment regions each station has been added to the index with
+    static std::array<std::vector<std::pair<TilePos2, TilePos2>>, Limits::kMaxStations> _indexedCatchments;
+    static std::bitset<Limits::kMaxStations> _catchmentIndexInvalidated;
+
+    static void refreshCatchmentIndex();
+
+    static size_t getTileIndex(const TilePos2& pos)
+    {
+        return pos.y * kMapColumns + pos.x;
+    }
+
     // 0x0048B1D8
     void reset()
     {
+        resetCatchmentIndex();
         for (auto& station : rawStations())
         {
             station.name = StringIds::null;
@@ -64,6 +94,149 @@ namespace OpenLoco::StationManager
         }
     }
 
+    void invalidateAcceptance(StationId id)
+    {
+        const auto index = enumValue(id);
+        if (index < Limits::kMaxStations)
+        {
+            _acceptanceInvalidated.set(index);
+        }
+    }
+
+    void invalidateCatchment(StationId id)
+    {
+        const auto index = enumValue(id);
+        if (index < Limits::kMaxStations)
+        {
+            _catchmentIndexInvalidated.set(index);
+        }
+        invalidateAcceptance(id);
+    }
+
+    // The stations are only looked up once the catchment index has been refreshed
+    void invalidateAcceptance(const TilePos2& pos)
+    {
+        if (!validCoords(pos))
+        {
+            return;
+        }
+
+        const auto index = getTileIndex(pos);
+        if (_tileInvalidated.test(index))
+        {
+            return;
+        }
+        _tileInvalidated.set(index);
+        _invalidatedTiles.push_back(pos);
+    }
+
+    void invalidateAcceptance(const Industry& industry)
+    {
+        // Called for each element of an industry that is being removed, the tiles only need queueing once
+        const auto id = enumValue(industry.id());
+        if (id < Limits::kMaxIndustries)
+        {
+            if (_industryInvalidated.test(id))
+            {
+                return;
+            }
+            _industryInvalidated.set(id);
+        }
+
+        for (auto i = 0; i < industry.numTiles; i++)
+        {
+            invalidateAcceptance(TilePos2(industry.tiles[i]));
+        }
+    }
+
+    void queueAcceptanceCheck(const TilePos2& pos)
+    {
+        if (!validCoords(pos))
+        {
+            return;
+        }
+
+        const auto index = getTileIndex(pos);
+        if (_acceptanceCheckQueued.test(index))
+        {
+            return;
+        }
+        _acceptanceCheckQueued.set(index);
+        _queuedAcceptanceChecks.push_back(pos);
+    }
+
+    static void processQueuedAcceptanceChecks()
+    {
+        for (const auto& pos : _queuedAcceptanceChecks)
+        {
+            _acceptanceCheckQueued.reset(getTileIndex(pos));
+            bool hasCatchmentElement = false;
+            for (auto& el : TileManager::get(pos))
+            {
+                if (el.isGhost())
+                {
+                    continue;
+                }
+                switch (el.type())
+                {
+                    case ElementType::building:
+                    case ElementType::industry:
+                        hasCatchmentElement = true;
+                        break;
+                    case ElementType::station:
+                        // Station tiles only change the catchment of their own station
+                        invalidateCatchment(el.get<StationElement>().stationId());
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            if (hasCatchmentElement)
+            {
+                invalidateAcceptance(pos);
+            }
+        }
+        _queuedAcceptanceChecks.clear();
+    }
+
+    // Called at the end of each tick so that no invalidated stations are left over between ticks, which would
+    // otherwise be missing from the state sent to joining clients.
+    void updateAcceptance()
+    {
+        if (!Game::hasFlags(1u << 0) || isEditorMode())
+        {
+            _queuedAcceptanceChecks.clear();
+            _acceptanceCheckQueued.reset();
+            _invalidatedTiles.clear();
+            _tileInvalidated.reset();
+            _industryInvalidated.reset();
+            _acceptanceInvalidated.reset();
+            return;
+        }
+
+        refreshCatchmentIndex();
+        if (_acceptanceInvalidated.none())
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < Limits::kMaxStations; i++)
+        {
+            if (!_acceptanceInvalidated.test(i))
+            {
+                continue;
+            }
+
+            auto* station = get(StationId(i));
+            if (station != nullptr && !station->empty())
+            {
+                station->update();
+            }
+        }
+        _acceptanceInvalidated.reset();
+    }
+
     // 0x0048DDC3
     void updateLabels()
     {
@@ -96,6 +269,46 @@ namespace OpenLoco::StationManager
         }
     }
 
+    // Below this many stations per thread starting the threads costs more than it saves
+    constexpr size_t kMinStationsPerThread = 64;
+
+    // Calls func for each index in [0, count), split over several threads when there are enough of them
+    template<typename TFunc>
+    static void forEachInParallel(size_t count, TFunc&& func)
+    {
+        const auto numThreads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), count / kMinStationsPerThread);
+        if (numThreads <= 1)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        const auto chunkSize = (count + numThreads - 1) / numThreads;
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < numThreads; t++)
+        {
+            const auto begin = t * chunkSize;
+            const auto end = std::min(count, begin + chunkSize);
+            threads.emplace_back([&func, begin, end] {
+                for (auto i = begin; i < end; i++)
+                {
+                    func(i);
+                }
+            });
+        }
+        for (size_t i = 0; i < chunkSize; i++)
+        {
+            func(i);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
     // 0x0048B244
     void updateDaily()
     {
@@ -104,6 +317,7 @@ namespace OpenLoco::StationManager
             town.flags &= ~TownFlags::ratingAdjusted;
         }
 
+        std::vector<Station*> updatedStations;
         for (auto& station : stations())
         {
             if (station.stationTileSize == 0)
@@ -124,13 +338,34 @@ namespace OpenLoco::StationManager
             {
                 station.var_29 = 0;
             }
-            if (station.updateCargo())
+            updatedStations.push_back(&station);
+        }
+
+        // Each station draws from its own random stream so the ratings do not depend on the order the
+        // stations are updated in. Only the seeds are taken from the game's generator.
+        const auto seed0 = gPrng().randNext();
+        const auto seed1 = gPrng().randNext();
+        std::vector<StationCargoUpdate> updates(updatedStations.size());
+        forEachInParallel(updatedStations.size(), [&](size_t i) {
+            auto* station = updatedStations[i];
+            const auto index = enumValue(station->id());
+            Utility::prng rng(seed0 ^ (index * 0x9E3779B9), seed1 + index);
+            rng.randNext();
+            updates[i] = station->updateCargoRatings(rng);
+        });
+
+        WindowManager::invalidate(WindowType::stationList);
+        for (size_t i = 0; i < updatedStations.size(); i++)
+        {
+            auto* station = updatedStations[i];
+            station->applyCargoUpdate(updates[i]);
+            if (updates[i].atLeastOneGoodRating)
             {
-                auto town = TownManager::get(station.town);
+                auto town = TownManager::get(station->town);
                 if (town != nullptr && !(town->flags & TownFlags::ratingAdjusted))
                 {
                     town->flags |= TownFlags::ratingAdjusted;
-                    town->adjustCompanyRating(station.owner, 1);
+                    town->adjustCompanyRating(station->owner, 1);
                 }
             }
         }
@@ -420,7 +655,7 @@ namespace OpenLoco::StationManager
         }
     }
 
-    static uint16_t deliverCargoToStations(const std::vector<std::pair<StationId, uint8_t>>& foundStations, const uint8_t cargoType, const uint8_t cargoQty)
+    static uint16_t deliverCargoToStations(stdx::span<const std::pair<StationId, uint8_t>> foundStations, const uint8_t cargoType, const uint8_t cargoQty)
     {
         if (foundStations.empty())
         {
@@ -456,47 +691,150 @@ namespace OpenLoco::StationManager
         return std::min<uint16_t>(cargoQtyDelivered, cargoQty);
     }
 
-    // 0x0042F2FE
-    uint16_t deliverCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const Map::Pos2& pos, const Map::TilePos2& size)
+    static void removeFromCatchmentIndex(StationId id)
     {
-        const auto initialLoc = TilePos2(pos) - TilePos2(4, 4);
-        const auto catchmentSize = size + TilePos2(8, 8);
-        // TODO: Use a fixed size array (max size 15)
-        std::vector<std::pair<StationId, uint8_t>> foundStations;
-        for (TilePos2 searchOffset{ 0, 0 }; searchOffset.y < catchmentSize.y; ++searchOffset.y)
+        auto& regions = _indexedCatchments[enumValue(id)];
+        for (const auto& [minPos, maxPos] : regions)
         {
-            for (; searchOffset.x < catchmentSize.x; ++searchOffset.x)
+            for (auto y = minPos.y; y <= maxPos.y; y++)
             {
-                const auto searchLoc = initialLoc + searchOffset;
-                if (!Map::validCoords(searchLoc))
+                for (auto x = minPos.x; x <= maxPos.x; x++)
                 {
-                    continue;
+                    auto& stations = _catchmentIndex[getTileIndex(TilePos2(x, y))];
+                    auto it = std::lower_bound(stations.begin(), stations.end(), id);
+                    if (it != stations.end() && *it == id)
+                    {
+                        stations.erase(it);
+                    }
                 }
+            }
+        }
+        regions.clear();
+    }
 
-                const auto tile = TileManager::get(searchLoc);
-                for (const auto& el : tile)
+    static void addToCatchmentIndex(const Station& station)
+    {
+        const auto id = station.id();
+        auto& regions = _indexedCatchments[enumValue(id)];
+        for (auto [minPos, maxPos] : station.getCatchmentRegions())
+        {
+            minPos.x = std::max<coord_t>(minPos.x, 0);
+            minPos.y = std::max<coord_t>(minPos.y, 0);
+            maxPos.x = std::min<coord_t>(maxPos.x, kMapColumns - 1);
+            maxPos.y = std::min<coord_t>(maxPos.y, kMapRows - 1);
+            if (minPos.x > maxPos.x || minPos.y > maxPos.y)
+            {
+                continue;
+            }
+
+            for (auto y = minPos.y; y <= maxPos.y; y++)
+            {
+                for (auto x = minPos.x; x <= maxPos.x; x++)
                 {
-                    auto* elStation = el.as<StationElement>();
-                    if (elStation == nullptr)
+                    auto& stations = _catchmentIndex[getTileIndex(TilePos2(x, y))];
+                    auto it = std::lower_bound(stations.begin(), stations.end(), id);
+                    if (it == stations.end() || *it != id)
                     {
-                        continue;
+                        stations.insert(it, id);
                     }
+                }
+            }
+            regions.emplace_back(minPos, maxPos);
+        }
+    }
 
-                    if (elStation->isFlag5() || elStation->isGhost())
-                    {
-                        continue;
-                    }
+    void resetCatchmentIndex()
+    {
+        _catchmentIndex.clear();
+        for (auto& regions : _indexedCatchments)
+        {
+            regions.clear();
+        }
+        _catchmentIndexInvalidated.reset();
+    }
+
+    // Invalidates the stations whose catchment covers the invalidated tiles, the index must be up to date
+    static void invalidateStationsOnTiles()
+    {
+        for (const auto& pos : _invalidatedTiles)
+        {
+            const auto index = getTileIndex(pos);
+            for (auto stationId : _catchmentIndex[index])
+            {
+                invalidateAcceptance(stationId);
+            }
+            _tileInvalidated.reset(index);
+        }
+        _invalidatedTiles.clear();
+        _industryInvalidated.reset();
+    }
+
+    // Brings the index up to date with any station tiles added or removed since it was last used
+    static void refreshCatchmentIndex()
+    {
+        processQueuedAcceptanceChecks();
+
+        if (_catchmentIndex.empty())
+        {
+            _catchmentIndex.resize(kMapSize);
+            for (auto& station : stations())
+            {
+                _catchmentIndexInvalidated.set(enumValue(station.id()));
+            }
+        }
+
+        if (_catchmentIndexInvalidated.any())
+        {
+            for (size_t i = 0; i < Limits::kMaxStations; i++)
+            {
+                if (!_catchmentIndexInvalidated.test(i))
+                {
+                    continue;
+                }
+
+                const auto id = StationId(i);
+                removeFromCatchmentIndex(id);
+                auto* station = get(id);
+                if (station != nullptr && !station->empty())
+                {
+                    addToCatchmentIndex(*station);
+                }
+            }
+            _catchmentIndexInvalidated.reset();
+        }
+
+        invalidateStationsOnTiles();
+    }
 
-                    if (foundStations.size() > 15)
+    // 0x0042F2FE
+    uint16_t deliverCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const Map::Pos2& pos, const Map::TilePos2& size)
+    {
+        refreshCatchmentIndex();
+
+        std::array<std::pair<StationId, uint8_t>, kMaxNearbyStations> foundStations;
+        size_t numFoundStations = 0;
+
+        const auto initialLoc = TilePos2(pos);
+        const auto xEnd = std::min<coord_t>(initialLoc.x + size.x, kMapColumns);
+        const auto yEnd = std::min<coord_t>(initialLoc.y + size.y, kMapRows);
+        for (auto y = std::max<coord_t>(initialLoc.y, 0); y < yEnd; y++)
+        {
+            for (auto x = std::max<coord_t>(initialLoc.x, 0); x < xEnd; x++)
+            {
+                for (auto stationId : _catchmentIndex[getTileIndex(TilePos2(x, y))])
+                {
+                    if (numFoundStations >= kMaxNearbyStations)
                     {
                         break;
                     }
-                    auto res = std::find_if(foundStations.begin(), foundStations.end(), [stationId = elStation->stationId()](const std::pair<StationId, uint8_t>& item) { return item.first == stationId; });
-                    if (res != foundStations.end())
+
+                    const auto begin = foundStations.begin();
+                    const auto end = begin + numFoundStations;
+                    if (std::find_if(begin, end, [stationId](const std::pair<StationId, uint8_t>& item) { return item.first == stationId; }) != end)
                     {
                         continue;
                     }
-                    auto* station = get(elStation->stationId());
+                    auto* station = get(stationId);
                     if (station == nullptr)
                     {
                         continue;
@@ -506,13 +844,12 @@ namespace OpenLoco::StationManager
                         continue;
                     }
 
-                    foundStations.push_back(std::make_pair(elStation->stationId(), station->cargoStats[cargoType].rating));
+                    foundStations[numFoundStations++] = std::make_pair(stationId, station->cargoStats[cargoType].rating);
                 }
             }
-            searchOffset.x = 0;
         }
 
-        return deliverCargoToStations(foundStations, cargoType, cargoQty);
+        return deliverCargoToStations(stdx::span<const std::pair<StationId, uint8_t>>(foundStations.data(), numFoundStations), cargoType, cargoQty);
     }
 
     // 0x0042F2BF
@@ -7,12 +7,18 @@
 #include <cstddef>
 #include <vector>
 
+namespace OpenLoco
+{
+    struct Industry;
+}
+
 namespace OpenLoco::StationManager
 {
     void reset();
     FixedVector<Station, Limits::kMaxStations> stations();
     Station* get(StationId id);
     void update();
+    void updateAcceptance();
     void updateLabels();
     void updateDaily();
     void sub_437F29(CompanyId cid, uint8_t arg1);
@@ -21,4 +27,18 @@ namespace OpenLoco::StationManager
     void registerHooks();
     uint16_t deliverCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const Map::Pos2& pos, const Map::TilePos2& size);
     uint16_t deliverCargoToStations(const std::vector<StationId>& stations, const uint8_t cargoType, const uint8_t cargoQty);
+
+    // Stations whose catchment has had a building, industry or station tile added or removed have their
+    // cargo acceptance recalculated at the end of the tick rather than waiting for their turn in update.
+    // Tiles are resolved to stations through the catchment index.
+    void invalidateAcceptance(StationId id);
+    void invalidateAcceptance(const Map::TilePos2& pos);
+    void invalidateAcceptance(const Industry& industry);
+
+    // A station tile has been added or removed, which also updates the index of stations by catchment tile.
+    void invalidateCatchment(StationId id);
+    void resetCatchmentIndex();
+
+    // Elements only get their type after being inserted so the tile is checked in updateAcceptance.
+    void queueAcceptanceCheck(const Map::TilePos2& pos);
 }
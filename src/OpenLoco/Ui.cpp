@@ -32,6 +32,7 @@
 #include "Config.h"
 #include "Console.h"
 #include "Drawing/FPSCounter.h"
+#include "Drawing/ProfilerOverlay.h"
 #include "Game.h"
 #include "GameCommands/GameCommands.h"
 #include "Graphics/Gfx.h"
@@ -40,6 +41,8 @@
 #include "Interop/Interop.hpp"
 #include "Intro.h"
 #include "MultiPlayer.h"
+#include "Paint/Paint.h"
+#include "Profiler.h"
 #include "SceneManager.h"
 #include "Tutorial.h"
 #include "Ui.h"
@@ -438,12 +441,15 @@ namespace OpenLoco::Ui
             return;
         }
 
+        Profiler::beginFrame();
         WindowManager::updateViewports();
 
         if (!Intro::isActive())
         {
             Gfx::drawDirtyBlocks();
         }
+        Profiler::endFrame();
+        Paint::endFrame();
 
         // Lock the surface before setting its pixels
         if (SDL_MUSTLOCK(surface))
@@ -460,6 +466,12 @@ namespace OpenLoco::Ui
             Drawing::drawFPS();
         }
 
+        // Draw profiler overlay?
+        if (Config::getNew().showProfiler && Profiler::isEnabled())
+        {
+            Drawing::drawProfiler();
+        }
+
         // Copy pixels from the virtual screen buffer to the surface
         auto& rt = Gfx::getScreenRT();
         if (rt.bits != nullptr)
@@ -190,6 +190,11 @@ namespace OpenLoco::Vehicles
 
     static std::optional<std::pair<Map::SignalElement*, Map::TrackElement*>> findSignalOnTrack(const Map::Pos3& signalLoc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, const uint8_t index)
     {
+        if (!Map::TileManager::hasElementOfType(Map::TilePos2(signalLoc), Map::ElementType::signal))
+        {
+            return std::nullopt;
+        }
+
         auto tile = Map::TileManager::get(signalLoc);
         for (auto& el : tile)
         {
@@ -435,7 +440,7 @@ namespace OpenLoco::Vehicles
             const auto rotPos = Math::Vector::rotate(Pos2{ trackPiece.x, trackPiece.y }, tad.cardinalDirection());
             const auto trackLoc = Pos2{ startLoc } + rotPos;
 
-            for (auto* entity : EntityManager::EntityTileList(trackLoc))
+            for (auto* entity : EntityManager::EntityTileList(trackLoc, EntityBaseType::vehicle))
             {
                 auto* vehicle = entity->asBase<Vehicles::VehicleBase>();
                 if (vehicle == nullptr)
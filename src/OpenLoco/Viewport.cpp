@@ -1,10 +1,18 @@
 #include "Viewport.hpp"
+#include "Config.h"
+#include "GameState.h"
 #include "Graphics/Gfx.h"
 #include "Interop/Interop.hpp"
 #include "Map/Tile.h"
 #include "Map/TileManager.h"
+#include "Paint/Paint.h"
+#include "Profiler.h"
+#include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include "Window.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Map;
@@ -35,17 +43,205 @@ namespace OpenLoco::Ui
         paint(rt, screenToViewport(intersection));
     }
 
+    static loco_global<uint16_t, 0x00E3F0BC> _viewportFlags;
+    static loco_global<int16_t, 0x00E3F0A6> _cutAwayHeight;
+    static loco_global<uint32_t[6], 0x0050BF58> _overlayColours;
+
+    // Width of the vertical strips a viewport is painted in, each strip is generated, sorted and drawn by
+    // its own paint session.
+    constexpr int32_t kPaintStripWidth = 32;
+
+    // Kept between paints so the sort entry buffers of the sessions are reused
+    static std::vector<Paint::PaintSession> _stripSessions;
+
+    // 0x0048DE97
+    static void drawStationNames(Gfx::RenderTarget& rt)
+    {
+        registers regs;
+        regs.edi = X86Pointer(&rt);
+        call(0x0048DE97, regs);
+    }
+
+    // 0x004977E5
+    static void drawTownNames(Gfx::RenderTarget& rt)
+    {
+        registers regs;
+        regs.edi = X86Pointer(&rt);
+        call(0x004977E5, regs);
+    }
+
+    // 0x0045A60E
+    static void drawStringStructs(Gfx::RenderTarget& rt)
+    {
+        registers regs;
+        regs.edi = X86Pointer(&rt);
+        call(0x0045A60E, regs);
+    }
+
+    // 0x00470A62
+    static void sub_470A62(Gfx::RenderTarget& rt)
+    {
+        registers regs;
+        regs.edi = X86Pointer(&rt);
+        call(0x00470A62, regs);
+    }
+
+    // Splits the area of the viewport render target into strips of kPaintStripWidth viewport units.
+    static std::vector<Gfx::RenderTarget> getPaintStrips(const Gfx::RenderTarget& target)
+    {
+        std::vector<Gfx::RenderTarget> strips;
+        const int32_t right = target.x + target.width;
+        for (int32_t stripX = target.x & ~(kPaintStripWidth - 1); stripX < right; stripX += kPaintStripWidth)
+        {
+            auto strip = target;
+            if (stripX >= target.x)
+            {
+                const auto skip = stripX - target.x;
+                strip.x = stripX;
+                strip.width -= skip;
+                strip.bits += skip >> target.zoomLevel;
+                strip.pitch += skip >> target.zoomLevel;
+            }
+
+            const auto stripRight = stripX + kPaintStripWidth;
+            if (strip.x + strip.width >= stripRight)
+            {
+                const auto excess = strip.x + strip.width - stripRight;
+                strip.width -= excess;
+                strip.pitch += excess >> target.zoomLevel;
+            }
+            strips.push_back(strip);
+        }
+        return strips;
+    }
+
+    // Below this many strips per thread starting the threads costs more than it saves
+    constexpr size_t kMinPaintStripsPerThread = 4;
+
+    // Calls func for each strip, split over several threads when there are enough of them
+    template<typename TFunc>
+    static void forEachStripInParallel(size_t count, TFunc&& func)
+    {
+        const auto numThreads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), count / kMinPaintStripsPerThread);
+        if (numThreads <= 1)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        // Strips are handed out one at a time as their cost varies a lot with what is in view
+        std::atomic<size_t> next{ 0 };
+        auto worker = [&func, &next, count] {
+            for (auto i = next++; i < count; i = next++)
+            {
+                func(i);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < numThreads; t++)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Sorting and drawing the structs only uses the session itself so it runs on the worker threads
+    static void drawStrip(Paint::PaintSession& session, Gfx::RenderTarget& strip, const uint16_t viewFlags)
+    {
+        const uint32_t fill = (viewFlags & (ViewportFlags::underground_view | ViewportFlags::flag_7 | ViewportFlags::flag_8)) ? 0x0A0A0A0A : 0xD8D8D8D8;
+        Gfx::clear(strip, fill);
+
+        session.sortStructs();
+        session.drawStructs();
+    }
+
+    // The overlay, names and strings are still drawn by vanilla functions so they are done on the main thread
+    static void finishStrip(Paint::PaintSession& session, Gfx::RenderTarget& strip, const uint16_t viewFlags)
+    {
+        session.makeCurrent();
+
+        const auto overlayColour = _overlayColours[getGameState().var_B956];
+        if (overlayColour != 0xFFFFFFFF)
+        {
+            Gfx::fillRect(strip, strip.x, strip.y, strip.x + strip.width - 1, strip.y + strip.height - 1, overlayColour);
+        }
+
+        if (!isTitleMode())
+        {
+            if (!(viewFlags & ViewportFlags::station_names_displayed) && Config::get().stationNamesMinScale >= strip.zoomLevel)
+            {
+                drawStationNames(strip);
+            }
+            if (!(viewFlags & ViewportFlags::town_names_displayed))
+            {
+                drawTownNames(strip);
+            }
+        }
+        drawStringStructs(strip);
+        sub_470A62(strip);
+    }
+
     // 0x0045A1A4
     void Viewport::paint(Gfx::RenderTarget* rt, const Rect& rect)
     {
-        registers regs{};
-        regs.ax = rect.left();
-        regs.bx = rect.top();
-        regs.dx = rect.right();
-        regs.bp = rect.bottom();
-        regs.esi = X86Pointer(this);
-        regs.edi = X86Pointer(rt);
-        call(0x0045A1A4, regs);
+        Profiler::ScopedZone zone(Profiler::Zone::viewportPaint);
+
+        _viewportFlags = flags;
+        if (flags & (ViewportFlags::hide_foreground_tracks_roads | ViewportFlags::hide_foreground_scenery_buildings))
+        {
+            _cutAwayHeight = viewHeight / 2 + viewY;
+        }
+
+        // Align the area to the zoom level and create a render target for it in viewport coordinates
+        const int16_t mask = static_cast<int16_t>(0xFFFF << zoom);
+        Gfx::RenderTarget target{};
+        target.x = rect.left() & mask;
+        target.y = rect.top() & mask;
+        target.width = (rect.right() - rect.left()) & mask;
+        target.height = (rect.bottom() - rect.top()) & mask;
+        target.zoomLevel = zoom;
+
+        const int32_t stride = rt->width + rt->pitch;
+        const int16_t screenX = ((target.x - (viewX & mask)) >> zoom) + x;
+        const int16_t screenY = ((target.y - (viewY & mask)) >> zoom) + y;
+        target.bits = rt->bits + (screenX - rt->x) + stride * (screenY - rt->y);
+        target.pitch = stride - (target.width >> zoom);
+
+        // Generating still calls into vanilla paint functions that share the global paint state so the strips
+        // are generated one after another, each keeping its paint structs until all strips are drawn.
+        auto strips = getPaintStrips(target);
+        _stripSessions.resize(strips.size());
+        for (size_t i = 0; i < strips.size(); i++)
+        {
+            auto& session = _stripSessions[i];
+            if (i == 0)
+            {
+                session.init(strips[i], flags);
+            }
+            else
+            {
+                session.initContinued(strips[i], flags);
+            }
+            session.generate();
+            session.collectStructs();
+        }
+
+        forEachStripInParallel(strips.size(), [&](size_t i) {
+            drawStrip(_stripSessions[i], strips[i], flags);
+        });
+
+        for (size_t i = 0; i < strips.size(); i++)
+        {
+            finishStrip(_stripSessions[i], strips[i], flags);
+        }
     }
 
     // 0x004CA444
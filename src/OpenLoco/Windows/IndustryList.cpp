@@ -21,6 +21,10 @@
 #include "../Ui/ScrollView.h"
 #include "../Ui/WindowManager.h"
 #include "../Widget.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -103,6 +107,9 @@ namespace OpenLoco::Ui::Windows::IndustryList
             ProductionTransported,
         };
 
+        // Number of updates between re-sorting the list, which picks up new industries and changed values
+        constexpr uint32_t kResortInterval = 16;
+
         // 0x00457B94
         static void prepareDraw(Window& self)
         {
@@ -211,35 +218,13 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.invalidate();
         }
 
-        // 0x00457A52
-        static bool orderByName(const OpenLoco::Industry& lhs, const OpenLoco::Industry& rhs)
+        // Values an industry is sorted by, computed once per industry rather than for every comparison
+        struct SortEntry
         {
-            char lhsString[256] = { 0 };
-            StringManager::formatString(lhsString, lhs.name, (void*)&lhs.town);
-
-            char rhsString[256] = { 0 };
-            StringManager::formatString(rhsString, rhs.name, (void*)&rhs.town);
-
-            return strcmp(lhsString, rhsString) < 0;
-        }
-
-        // 0x00457A9F
-        static bool orderByStatus(OpenLoco::Industry& lhs, OpenLoco::Industry& rhs)
-        {
-            char lhsString[256] = { 0 };
-            const char* lhsBuffer = StringManager::getString(StringIds::buffer_1250);
-            lhs.getStatusString((char*)lhsBuffer);
-
-            StringManager::formatString(lhsString, StringIds::buffer_1250);
-
-            char rhsString[256] = { 0 };
-            const char* rhsBuffer = StringManager::getString(StringIds::buffer_1250);
-            rhs.getStatusString((char*)rhsBuffer);
-
-            StringManager::formatString(rhsString, StringIds::buffer_1250);
-
-            return strcmp(lhsString, rhsString) < 0;
-        }
+            IndustryId id;
+            std::string text;
+            uint8_t productionTransported;
+        };
 
         static uint8_t getAverageTransportedCargo(const OpenLoco::Industry& industry)
         {
@@ -262,91 +247,47 @@ namespace OpenLoco::Ui::Windows::IndustryList
             return productionTransported;
         }
 
-        // 0x00457AF3
-        static bool orderByProductionTransported(const OpenLoco::Industry& lhs, const OpenLoco::Industry& rhs)
-        {
-            auto lhsVar = getAverageTransportedCargo(lhs);
-
-            auto rhsVar = getAverageTransportedCargo(rhs);
-
-            return rhsVar < lhsVar;
-        }
-
         // 0x00457A52, 0x00457A9F, 0x00457AF3
-        static bool getOrder(const SortMode mode, OpenLoco::Industry& lhs, OpenLoco::Industry& rhs)
+        static SortEntry getSortEntry(const SortMode mode, OpenLoco::Industry& industry)
         {
+            SortEntry entry{ industry.id(), {}, 0 };
+            char buffer[256] = { 0 };
             switch (mode)
             {
                 case SortMode::Name:
-                    return orderByName(lhs, rhs);
+                    StringManager::formatString(buffer, industry.name, (void*)&industry.town);
+                    entry.text = buffer;
+                    break;
 
                 case SortMode::Status:
-                    return orderByStatus(lhs, rhs);
+                {
+                    const char* statusBuffer = StringManager::getString(StringIds::buffer_1250);
+                    industry.getStatusString((char*)statusBuffer);
+                    StringManager::formatString(buffer, StringIds::buffer_1250);
+                    entry.text = buffer;
+                    break;
+                }
 
                 case SortMode::ProductionTransported:
-                    return orderByProductionTransported(lhs, rhs);
+                    entry.productionTransported = getAverageTransportedCargo(industry);
+                    break;
             }
-
-            return false;
+            return entry;
         }
 
-        // 0x00457991
-        static void updateIndustryList(Window* self)
+        static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
         {
-            auto chosenIndustry = IndustryId::null;
-
-            for (auto& industry : IndustryManager::industries())
-            {
-                if ((industry.flags & IndustryFlags::sorted) != 0)
-                    continue;
-
-                if (chosenIndustry == IndustryId::null)
-                {
-                    chosenIndustry = industry.id();
-                    continue;
-                }
-
-                if (getOrder(SortMode(self->sortMode), industry, *IndustryManager::get(chosenIndustry)))
-                {
-                    chosenIndustry = industry.id();
-                }
-            }
-
-            if (chosenIndustry != IndustryId::null)
+            switch (mode)
             {
-                bool shouldInvalidate = false;
-
-                IndustryManager::get(chosenIndustry)->flags |= IndustryFlags::sorted;
-
-                auto ebp = self->rowCount;
-                if (chosenIndustry != IndustryId(self->rowInfo[ebp]))
-                {
-                    self->rowInfo[ebp] = enumValue(chosenIndustry);
-                    shouldInvalidate = true;
-                }
-
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
-                {
-                    self->var_83C = self->rowCount;
-                    shouldInvalidate = true;
-                }
+                case SortMode::Name:
+                case SortMode::Status:
+                    return strcmp(lhs.text.c_str(), rhs.text.c_str()) < 0;
 
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
+                case SortMode::ProductionTransported:
+                    return rhs.productionTransported < lhs.productionTransported;
             }
-            else
-            {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
 
-                Common::refreshIndustryList(self);
-            }
+            return false;
         }
 
         // 0x004580AE
@@ -357,10 +298,10 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::industryList, self.number, self.currentTab + Common::widx::tab_industry_list);
 
-            // Add three industries every tick.
-            updateIndustryList(&self);
-            updateIndustryList(&self);
-            updateIndustryList(&self);
+            if (self.frameNo % kResortInterval == 0)
+            {
+                Common::refreshIndustryList(&self);
+            }
         }
 
         // 0x00457EE8
@@ -1297,14 +1238,41 @@ namespace OpenLoco::Ui::Windows::IndustryList
             }
         }
 
-        // 0x00457964
+        // 0x00457964, 0x00457991
+        // Vanilla sorted one row per update by marking industries as sorted, so long lists took a long time to settle.
+        // The list is now sorted in one go and re-sorted every kResortInterval updates.
         static void refreshIndustryList(Window* window)
         {
-            window->rowCount = 0;
+            const auto mode = IndustryList::SortMode(window->sortMode);
 
+            std::vector<IndustryList::SortEntry> entries;
             for (auto& industry : IndustryManager::industries())
             {
-                industry.flags &= ~IndustryFlags::sorted;
+                entries.push_back(IndustryList::getSortEntry(mode, industry));
+            }
+
+            // Stable so that equal industries stay in id order like the original selection sort
+            std::stable_sort(entries.begin(), entries.end(), [mode](const IndustryList::SortEntry& lhs, const IndustryList::SortEntry& rhs) {
+                return IndustryList::getOrder(mode, lhs, rhs);
+            });
+
+            const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(window->rowInfo)));
+            bool shouldInvalidate = numRows != window->var_83C;
+            for (uint16_t i = 0; i < numRows; i++)
+            {
+                const auto industryId = static_cast<int16_t>(enumValue(entries[i].id));
+                if (window->rowInfo[i] != industryId)
+                {
+                    window->rowInfo[i] = industryId;
+                    shouldInvalidate = true;
+                }
+            }
+
+            window->rowCount = numRows;
+            window->var_83C = numRows;
+            if (shouldInvalidate)
+            {
+                window->invalidate();
             }
         }
 
@@ -16,6 +16,10 @@
 #include "../Ui/Dropdown.h"
 #include "../Ui/WindowManager.h"
 #include "../Widget.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -126,102 +130,79 @@ namespace OpenLoco::Ui::Windows::StationList
         _events.tooltip = tooltip;
     }
 
-    // 0x004910E8
-    static void refreshStationList(Window* window)
-    {
-        window->rowCount = 0;
-
-        for (auto& station : StationManager::stations())
-        {
-            if (station.owner == CompanyId(window->number))
-            {
-                station.flags &= ~StationFlags::flag_4;
-            }
-        }
-    }
+    // Number of updates between re-sorting the list, which picks up new stations and changed values
+    constexpr uint32_t kResortInterval = 16;
 
-    // 0x004911FD
-    static bool orderByName(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    // Values a station is sorted by, computed once per station rather than for every comparison
+    struct SortEntry
     {
-        char lhsString[256] = { 0 };
-        StringManager::formatString(lhsString, lhs.name, (void*)&lhs.town);
-
-        char rhsString[256] = { 0 };
-        StringManager::formatString(rhsString, rhs.name, (void*)&rhs.town);
-
-        return strcmp(lhsString, rhsString) < 0;
-    }
+        StationId id;
+        std::string text;
+        uint32_t quantity;
+    };
 
-    // 0x00491281, 0x00491247
-    static bool orderByQuantity(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    // 0x004911FD, 0x00491247, 0x00491281, 0x004912BB
+    static SortEntry getSortEntry(const SortMode mode, const OpenLoco::Station& station)
     {
-        uint32_t lhsSum = 0;
-        for (const auto& cargo : lhs.cargoStats)
-        {
-            lhsSum += cargo.quantity;
-        }
-
-        uint32_t rhsSum = 0;
-        for (const auto& cargo : rhs.cargoStats)
+        SortEntry entry{ station.id(), {}, 0 };
+        char buffer[256] = { 0 };
+        switch (mode)
         {
-            rhsSum += cargo.quantity;
-        }
-
-        return rhsSum < lhsSum;
-    }
-
-    // 0x004912BB
-    static bool orderByAccepts(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
-    {
-        char* ptr;
+            case SortMode::Name:
+                StringManager::formatString(buffer, station.name, (void*)&station.town);
+                entry.text = buffer;
+                break;
 
-        char lhsString[256] = { 0 };
-        ptr = &lhsString[0];
-        for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
-        {
-            if (lhs.cargoStats[cargoId].isAccepted())
-            {
-                ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
-            }
-        }
+            case SortMode::Status:
+            case SortMode::TotalUnitsWaiting:
+                for (const auto& cargo : station.cargoStats)
+                {
+                    entry.quantity += cargo.quantity;
+                }
+                break;
 
-        char rhsString[256] = { 0 };
-        ptr = &rhsString[0];
-        for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
-        {
-            if (rhs.cargoStats[cargoId].isAccepted())
+            case SortMode::CargoAccepted:
             {
-                ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
+                char* ptr = &buffer[0];
+                for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
+                {
+                    if (station.cargoStats[cargoId].isAccepted())
+                    {
+                        ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
+                    }
+                }
+                entry.text = buffer;
+                break;
             }
         }
-
-        return strcmp(lhsString, rhsString) < 0;
+        return entry;
     }
 
-    // 0x004911FD, 0x00491247, 0x00491281, 0x004912BB
-    static bool getOrder(const SortMode mode, const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
     {
         switch (mode)
         {
             case SortMode::Name:
-                return orderByName(lhs, rhs);
+            case SortMode::CargoAccepted:
+                return strcmp(lhs.text.c_str(), rhs.text.c_str()) < 0;
 
             case SortMode::Status:
             case SortMode::TotalUnitsWaiting:
-                return orderByQuantity(lhs, rhs);
-
-            case SortMode::CargoAccepted:
-                return orderByAccepts(lhs, rhs);
+                return rhs.quantity < lhs.quantity;
         }
 
         return false;
     }
 
-    // 0x0049111A
-    static void updateStationList(Window* window)
+    // 0x004910E8, 0x0049111A
+    // Vanilla sorted one row per update by marking stations with flag_4, so long lists took a long time to settle.
+    // The list is now sorted in one go and re-sorted every kResortInterval updates.
+    static void refreshStationList(Window* window)
     {
-        StationId edi = StationId::null;
+        const auto mode = SortMode(window->sortMode);
+        const uint16_t mask = tabInformationByType[window->currentTab].stationMask;
 
+        std::vector<SortEntry> entries;
         for (auto& station : StationManager::stations())
         {
             if (station.owner != CompanyId(window->number))
@@ -230,59 +211,34 @@ namespace OpenLoco::Ui::Windows::StationList
             if ((station.flags & StationFlags::flag_5) != 0)
                 continue;
 
-            const uint16_t mask = tabInformationByType[window->currentTab].stationMask;
             if ((station.flags & mask) == 0)
                 continue;
 
-            if ((station.flags & StationFlags::flag_4) != 0)
-                continue;
-
-            if (edi == StationId::null)
-            {
-                edi = station.id();
-                continue;
-            }
-
-            if (getOrder(SortMode(window->sortMode), station, *StationManager::get(edi)))
-            {
-                edi = station.id();
-            }
+            entries.push_back(getSortEntry(mode, station));
         }
 
-        if (edi != StationId::null)
-        {
-            bool dl = false;
-
-            StationManager::get(edi)->flags |= StationFlags::flag_4;
-
-            auto ebp = window->rowCount;
-            if (edi != StationId(window->rowInfo[ebp]))
-            {
-                window->rowInfo[ebp] = enumValue(edi);
-                dl = true;
-            }
-
-            window->rowCount += 1;
-            if (window->rowCount > window->var_83C)
-            {
-                window->var_83C = window->rowCount;
-                dl = true;
-            }
+        // Stable so that equal stations stay in id order like the original selection sort
+        std::stable_sort(entries.begin(), entries.end(), [mode](const SortEntry& lhs, const SortEntry& rhs) {
+            return getOrder(mode, lhs, rhs);
+        });
 
-            if (dl)
-            {
-                window->invalidate();
-            }
-        }
-        else
+        const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(window->rowInfo)));
+        bool shouldInvalidate = numRows != window->var_83C;
+        for (uint16_t i = 0; i < numRows; i++)
         {
-            if (window->var_83C != window->rowCount)
+            const auto stationId = static_cast<int16_t>(enumValue(entries[i].id));
+            if (window->rowInfo[i] != stationId)
             {
-                window->var_83C = window->rowCount;
-                window->invalidate();
+                window->rowInfo[i] = stationId;
+                shouldInvalidate = true;
             }
+        }
 
-            refreshStationList(window);
+        window->rowCount = numRows;
+        window->var_83C = numRows;
+        if (shouldInvalidate)
+        {
+            window->invalidate();
         }
     }
 
@@ -585,12 +541,11 @@ namespace OpenLoco::Ui::Windows::StationList
         window.owner = companyId;
         window.sortMode = 0;
         window.rowCount = 0;
-
-        refreshStationList(&window);
-
         window.var_83C = 0;
         window.rowHover = -1;
 
+        refreshStationList(&window);
+
         window.callOnResize();
         window.callPrepareDraw();
         window.initScrollWidgets();
@@ -699,10 +654,10 @@ namespace OpenLoco::Ui::Windows::StationList
         window.callPrepareDraw();
         WindowManager::invalidateWidget(WindowType::stationList, window.number, window.currentTab + 4);
 
-        // Add three stations every tick.
-        updateStationList(&window);
-        updateStationList(&window);
-        updateStationList(&window);
+        if (window.frameNo % kResortInterval == 0)
+        {
+            refreshStationList(&window);
+        }
     }
 
     // 0x00491999
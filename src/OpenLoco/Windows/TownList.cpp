@@ -20,6 +20,10 @@
 #include "../Ui/WindowManager.h"
 #include "../Utility/Numeric.hpp"
 #include "../Widget.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -110,6 +114,9 @@ namespace OpenLoco::Ui::Windows::TownList
             Stations,
         };
 
+        // Number of updates between re-sorting the list, which picks up new towns and changed values
+        constexpr uint32_t kResortInterval = 16;
+
         // 0x00499F53
         static void prepareDraw(Ui::Window& self)
         {
@@ -290,38 +297,46 @@ namespace OpenLoco::Ui::Windows::TownList
             self.invalidate();
         }
 
-        // 0x00499EC9
-        static bool orderByName(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
+        // Values a town is sorted by, computed once per town rather than for every comparison
+        struct SortEntry
         {
-            char lhsString[256] = { 0 };
-            StringManager::formatString(lhsString, lhs.name);
+            TownId id;
+            std::string name;
+            TownSize size;
+            uint32_t population;
+            uint16_t numStations;
+        };
 
-            char rhsString[256] = { 0 };
-            StringManager::formatString(rhsString, rhs.name);
+        static SortEntry getSortEntry(const SortMode mode, const OpenLoco::Town& town)
+        {
+            SortEntry entry{ town.id(), {}, town.size, town.population, town.numStations };
+            if (mode == SortMode::Name)
+            {
+                char buffer[256] = { 0 };
+                StringManager::formatString(buffer, town.name);
+                entry.name = buffer;
+            }
+            return entry;
+        }
 
-            return strcmp(lhsString, rhsString) < 0;
+        // 0x00499EC9
+        static bool orderByName(const SortEntry& lhs, const SortEntry& rhs)
+        {
+            return strcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
         }
 
         // 0x00499F28
-        static bool orderByPopulation(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
+        static bool orderByPopulation(const SortEntry& lhs, const SortEntry& rhs)
         {
-            auto lhsPopulation = lhs.population;
-
-            auto rhsPopulation = rhs.population;
-
-            return rhsPopulation < lhsPopulation;
+            return rhs.population < lhs.population;
         }
 
         // 0x00499F0A Left this in to match the x86 code. can be replaced with orderByPopulation
-        static bool orderByType(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
+        static bool orderByType(const SortEntry& lhs, const SortEntry& rhs)
         {
-            auto lhsSize = lhs.size;
-
-            auto rhsSize = rhs.size;
-
-            if (rhsSize != lhsSize)
+            if (rhs.size != lhs.size)
             {
-                return rhsSize < lhsSize;
+                return rhs.size < lhs.size;
             }
             else
             {
@@ -330,17 +345,13 @@ namespace OpenLoco::Ui::Windows::TownList
         }
 
         // 0x00499F3B
-        static bool orderByStations(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
+        static bool orderByStations(const SortEntry& lhs, const SortEntry& rhs)
         {
-            auto lhsStations = lhs.numStations;
-
-            auto rhsStations = rhs.numStations;
-
-            return rhsStations < lhsStations;
+            return rhs.numStations < lhs.numStations;
         }
 
         // 0x00499EC9, 0x00499F0A, 0x00499F28, 0x00499F3B
-        static bool getOrder(const SortMode mode, OpenLoco::Town& lhs, OpenLoco::Town& rhs)
+        static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
         {
             switch (mode)
             {
@@ -360,63 +371,6 @@ namespace OpenLoco::Ui::Windows::TownList
             return false;
         }
 
-        // 0x00499E0B
-        static void updateTownList(Window* self)
-        {
-            TownId chosenTown = TownId::null;
-            for (auto& town : TownManager::towns())
-            {
-                if ((town.flags & TownFlags::sorted) != 0)
-                    continue;
-
-                if (chosenTown == TownId::null)
-                {
-                    chosenTown = town.id();
-                    continue;
-                }
-
-                if (getOrder(SortMode(self->sortMode), town, *TownManager::get(chosenTown)))
-                {
-                    chosenTown = town.id();
-                }
-            }
-
-            if (chosenTown != TownId::null)
-            {
-                bool shouldInvalidate = false;
-
-                TownManager::get(chosenTown)->flags |= TownFlags::sorted;
-
-                if (chosenTown != TownId(self->rowInfo[self->rowCount]))
-                {
-                    self->rowInfo[self->rowCount] = enumValue(chosenTown);
-                    shouldInvalidate = true;
-                }
-
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
-                {
-                    self->var_83C = self->rowCount;
-                    shouldInvalidate = true;
-                }
-
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
-            }
-            else
-            {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
-
-                Common::refreshTownList(self);
-            }
-        }
-
         // 0x0049A4A0
         static void onUpdate(Window& self)
         {
@@ -425,10 +379,10 @@ namespace OpenLoco::Ui::Windows::TownList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::townList, self.number, self.currentTab + Common::widx::tab_town_list);
 
-            // Add three towns every tick.
-            updateTownList(&self);
-            updateTownList(&self);
-            updateTownList(&self);
+            if (self.frameNo % kResortInterval == 0)
+            {
+                Common::refreshTownList(&self);
+            }
         }
 
         // 0x0049A4D0
@@ -1623,14 +1577,41 @@ namespace OpenLoco::Ui::Windows::TownList
             self->moveInsideScreenEdges();
         }
 
-        // 0x00499DDE
+        // 0x00499DDE, 0x00499E0B
+        // Vanilla sorted one row per update by marking towns as sorted, so long lists took a long time to settle.
+        // The list is now sorted in one go and re-sorted every kResortInterval updates.
         static void refreshTownList(Window* self)
         {
-            self->rowCount = 0;
+            const auto mode = TownList::SortMode(self->sortMode);
 
+            std::vector<TownList::SortEntry> entries;
             for (auto& town : TownManager::towns())
             {
-                town.flags &= ~TownFlags::sorted;
+                entries.push_back(TownList::getSortEntry(mode, town));
+            }
+
+            // Stable so that equal towns stay in id order like the original selection sort
+            std::stable_sort(entries.begin(), entries.end(), [mode](const TownList::SortEntry& lhs, const TownList::SortEntry& rhs) {
+                return TownList::getOrder(mode, lhs, rhs);
+            });
+
+            const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(self->rowInfo)));
+            bool shouldInvalidate = numRows != self->var_83C;
+            for (uint16_t i = 0; i < numRows; i++)
+            {
+                const auto townId = static_cast<int16_t>(enumValue(entries[i].id));
+                if (self->rowInfo[i] != townId)
+                {
+                    self->rowInfo[i] = townId;
+                    shouldInvalidate = true;
+                }
+            }
+
+            self->rowCount = numRows;
+            self->var_83C = numRows;
+            if (shouldInvalidate)
+            {
+                self->invalidate();
             }
         }
 
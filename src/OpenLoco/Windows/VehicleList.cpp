@@ -20,8 +20,11 @@
 #include "../Vehicles/Orders.h"
 #include "../Vehicles/Vehicle.h"
 #include "../Widget.h"
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -94,6 +97,9 @@ namespace OpenLoco::Ui::Windows::VehicleList
         Reliability,
     };
 
+    // Number of updates between re-sorting the list, which picks up new vehicles and changed values
+    constexpr uint32_t kResortInterval = 16;
+
     enum FilterMode : uint8_t
     {
         allVehicles,
@@ -177,71 +183,55 @@ namespace OpenLoco::Ui::Windows::VehicleList
         return false;
     }
 
-    // 0x004C1D4F
-    static void refreshVehicleList(Window* self)
+    // Values a vehicle is sorted by, computed once per vehicle rather than for every comparison
+    struct SortEntry
     {
-        refreshActiveStation(self);
-        self->rowCount = 0;
-        for (auto vehicle : EntityManager::VehicleList())
-        {
-            if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
-                continue;
-
-            if (vehicle->owner != CompanyId(self->number))
-                continue;
-
-            if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
-                continue;
-
-            if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
-                continue;
+        EntityId id;
+        std::string name;
+        currency32_t profit;
+        uint32_t dayCreated;
+        uint8_t reliability;
+    };
 
-            vehicle->var_0C &= ~Vehicles::Flags0C::sorted;
+    static SortEntry getSortEntry(const SortMode mode, const VehicleHead& head)
+    {
+        Vehicles::Vehicle train(head);
+        SortEntry entry{ head.id, {}, train.veh2->totalRecentProfit(), train.veh1->dayCreated, train.veh2->reliability };
+        if (mode == SortMode::Name)
+        {
+            char buffer[256] = { 0 };
+            auto args = FormatArguments::common(head.ordinalNumber);
+            StringManager::formatString(buffer, head.name, &args);
+            entry.name = buffer;
         }
+        return entry;
     }
 
     // 0x004C1E4F
-    static bool orderByName(const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool orderByName(const SortEntry& lhs, const SortEntry& rhs)
     {
-        char lhsString[256] = { 0 };
-        auto args = FormatArguments::common(lhs.ordinalNumber);
-        StringManager::formatString(lhsString, lhs.name, &args);
-
-        char rhsString[256] = { 0 };
-        args = FormatArguments::common(rhs.ordinalNumber);
-        StringManager::formatString(rhsString, rhs.name, &args);
-
-        return Utility::strlogicalcmp(lhsString, rhsString) < 0;
+        return Utility::strlogicalcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
     }
 
     // 0x004C1EC9
-    static bool orderByProfit(const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool orderByProfit(const SortEntry& lhs, const SortEntry& rhs)
     {
-        auto profitL = Vehicles::Vehicle(lhs).veh2->totalRecentProfit();
-        auto profitR = Vehicles::Vehicle(rhs).veh2->totalRecentProfit();
-
-        return profitR - profitL < 0;
+        return rhs.profit - lhs.profit < 0;
     }
 
     // 0x004C1F1E
-    static bool orderByAge(const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool orderByAge(const SortEntry& lhs, const SortEntry& rhs)
     {
-        auto dayCreatedL = Vehicles::Vehicle(lhs).veh1->dayCreated;
-        auto dayCreatedR = Vehicles::Vehicle(rhs).veh1->dayCreated;
-
-        return static_cast<int32_t>(dayCreatedL - dayCreatedR) < 0;
+        return static_cast<int32_t>(lhs.dayCreated - rhs.dayCreated) < 0;
     }
 
     // 0x004C1F45
-    static bool orderByReliability(const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool orderByReliability(const SortEntry& lhs, const SortEntry& rhs)
     {
-        auto reliabilityL = Vehicles::Vehicle(lhs).veh2->reliability;
-        auto reliabilityR = Vehicles::Vehicle(rhs).veh2->reliability;
-
-        return static_cast<int32_t>(reliabilityR - reliabilityL) < 0;
+        return static_cast<int32_t>(rhs.reliability - lhs.reliability) < 0;
     }
 
-    static bool getOrder(const SortMode mode, const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
     {
         switch (mode)
         {
@@ -261,11 +251,16 @@ namespace OpenLoco::Ui::Windows::VehicleList
         return false;
     }
 
-    // 0x004C1D92
-    static void updateVehicleList(Window* self)
+    // 0x004C1D4F, 0x004C1D92
+    // Vanilla sorted one row per update by marking vehicles as sorted, so long lists took a long time to settle.
+    // The list is now sorted in one go and re-sorted every kResortInterval updates. Sold vehicles are removed
+    // straight away by removeTrainFromList.
+    static void refreshVehicleList(Window* self)
     {
-        EntityId insertId = EntityId::null;
+        refreshActiveStation(self);
 
+        const auto mode = SortMode(self->sortMode);
+        std::vector<SortEntry> entries;
         for (auto vehicle : EntityManager::VehicleList())
         {
             if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
@@ -274,58 +269,37 @@ namespace OpenLoco::Ui::Windows::VehicleList
             if (vehicle->owner != CompanyId(self->number))
                 continue;
 
-            if (vehicle->var_0C & Vehicles::Flags0C::sorted)
-                continue;
-
             if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
                 continue;
 
             if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
                 continue;
 
-            if (insertId == EntityId::null)
-            {
-                insertId = vehicle->id;
-                continue;
-            }
-
-            auto* insertVehicle = EntityManager::get<VehicleHead>(insertId);
-            if (insertVehicle == nullptr)
-            {
-                continue;
-            }
-            if (getOrder(SortMode(self->sortMode), *vehicle, *insertVehicle))
-            {
-                insertId = vehicle->id;
-                continue;
-            }
+            entries.push_back(getSortEntry(mode, *vehicle));
         }
 
-        if (insertId != EntityId::null)
+        // Stable so that equal vehicles stay in list order like the original selection sort
+        std::stable_sort(entries.begin(), entries.end(), [mode](const SortEntry& lhs, const SortEntry& rhs) {
+            return getOrder(mode, lhs, rhs);
+        });
+
+        const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(self->rowInfo)));
+        bool shouldInvalidate = numRows != self->var_83C;
+        for (uint16_t i = 0; i < numRows; i++)
         {
-            auto vehicle = EntityManager::get<VehicleHead>(insertId);
-            if (vehicle == nullptr)
+            const auto vehicleId = static_cast<int16_t>(enumValue(entries[i].id));
+            if (self->rowInfo[i] != vehicleId)
             {
-                self->var_83C = self->rowCount;
-                refreshVehicleList(self);
-                return;
+                self->rowInfo[i] = vehicleId;
+                shouldInvalidate = true;
             }
-            vehicle->var_0C |= Vehicles::Flags0C::sorted;
-
-            if (vehicle->id != EntityId(self->rowInfo[self->rowCount]))
-                self->rowInfo[self->rowCount] = enumValue(vehicle->id);
-
-            self->rowCount++;
-
-            if (self->rowCount > self->var_83C)
-                self->var_83C = self->rowCount;
         }
-        else
-        {
-            if (self->var_83C != self->rowCount)
-                self->var_83C = self->rowCount;
 
-            refreshVehicleList(self);
+        self->rowCount = numRows;
+        self->var_83C = numRows;
+        if (shouldInvalidate)
+        {
+            self->invalidate();
         }
     }
 
@@ -817,10 +791,9 @@ namespace OpenLoco::Ui::Windows::VehicleList
             self->width = 220;
 
         self->rowCount = 0;
-        refreshVehicleList(self);
-
         self->var_83C = 0;
         self->rowHover = -1;
+        refreshVehicleList(self);
 
         self->callOnResize();
         self->callOnPeriodicUpdate();
@@ -937,10 +910,9 @@ namespace OpenLoco::Ui::Windows::VehicleList
         disableUnavailableVehicleTypes(self);
 
         self->rowCount = 0;
-        refreshVehicleList(self);
-
         self->var_83C = 0;
         self->rowHover = -1;
+        refreshVehicleList(self);
 
         self->callOnResize();
         self->callPrepareDraw();
@@ -985,9 +957,10 @@ namespace OpenLoco::Ui::Windows::VehicleList
         auto widgetIndex = getTabFromType(static_cast<VehicleType>(self.currentTab));
         WindowManager::invalidateWidget(WindowType::vehicleList, self.number, widgetIndex);
 
-        updateVehicleList(&self);
-        updateVehicleList(&self);
-        updateVehicleList(&self);
+        if (self.frameNo % kResortInterval == 0)
+        {
+            refreshVehicleList(&self);
+        }
 
         self.invalidate();
     }